@@ -2,6 +2,507 @@
 
 
 #include "Audio/AudioManager.h"
+#include "Components/AudioComponent.h"
+#include "Sound/SoundWave.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "UObject/GCObject.h"
+#include "Containers/Ticker.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Algo/BinarySearch.h"
+#include "AudioDevice.h"
+#include "AudioThread.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Async/Async.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeRWLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.inl"
+#include "Quartz/QuartzSubsystem.h"
+#include <atomic>
+
+#pragma region Instrumentation
+
+UE_TRACE_CHANNEL_DEFINE(AudioManagerChannel)
+
+UE_TRACE_EVENT_BEGIN(AudioManager, SoundRequest)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, SoundId)
+	UE_TRACE_EVENT_FIELD(uint32, LatencyUs)
+	UE_TRACE_EVENT_FIELD(uint8, Outcome)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, SoundName)
+UE_TRACE_EVENT_END()
+
+namespace
+{
+	TAutoConsoleVariable<bool> CVarAudioInstrumentation(
+		TEXT("audio.Instrumentation"),
+		true,
+		TEXT("Per-sound play/cull counters and request-to-start histograms in UAudioManager."));
+
+	/** What happened to a play request; mirrored in the trace event. */
+	enum class ESoundRequestOutcome : uint8
+	{
+		Started,
+		Culled,
+		Rejected,
+		/** Folded into an identical request already in the frame's command buffer */
+		Merged
+	};
+
+	/** Latency buckets are powers of two in microseconds: [0,1), [1,2), [2,4) ... [2^18, inf). */
+	constexpr int32 NumLatencyBuckets = 20;
+
+	/** Counters for one sound. Updated with relaxed atomics so producers never contend on a lock. */
+	struct FAudioSoundStats
+	{
+		FString Name;
+		/** MakeSoundId of the asset path: the same ID the sound cache and manifest use, stable across sessions */
+		uint64 SoundId = 0;
+		std::atomic<uint64> Plays{ 0 };
+		std::atomic<uint64> Culls{ 0 };
+		std::atomic<uint64> Rejects{ 0 };
+		std::atomic<uint64> Merges{ 0 };
+		std::atomic<uint64> TotalLatencyCycles{ 0 };
+		std::atomic<uint32> LatencyHistogram[NumLatencyBuckets] = {};
+
+		void Reset()
+		{
+			Plays.store(0, std::memory_order_relaxed);
+			Culls.store(0, std::memory_order_relaxed);
+			Rejects.store(0, std::memory_order_relaxed);
+			Merges.store(0, std::memory_order_relaxed);
+			TotalLatencyCycles.store(0, std::memory_order_relaxed);
+			for (std::atomic<uint32>& Bucket : LatencyHistogram)
+			{
+				Bucket.store(0, std::memory_order_relaxed);
+			}
+		}
+	};
+
+	/**
+	 * Stats per sound. Entries are never removed, so a looked-up pointer stays valid and may be cached;
+	 * RecordSoundRequest keeps a per-thread cache of them so only first sightings take the lock.
+	 */
+	struct FAudioInstrumentation
+	{
+		FRWLock Lock;
+		TMap<FObjectKey, TUniquePtr<FAudioSoundStats>> Stats;
+
+		/** @param KnownId - MakeSoundId of the sound when the caller has it; 0 derives it from the path. */
+		FAudioSoundStats& FindOrAdd(const USoundBase* Sound, uint64 KnownId = 0)
+		{
+			const FObjectKey Key(Sound);
+			{
+				FReadScopeLock ReadLock(Lock);
+				if (const TUniquePtr<FAudioSoundStats>* Found = Stats.Find(Key))
+				{
+					return **Found;
+				}
+			}
+
+			FWriteScopeLock WriteLock(Lock);
+			TUniquePtr<FAudioSoundStats>& Entry = Stats.FindOrAdd(Key);
+			if (!Entry.IsValid())
+			{
+				Entry = MakeUnique<FAudioSoundStats>();
+				Entry->Name = Sound->GetName();
+				Entry->SoundId = KnownId != 0 ? KnownId : MakeSoundId(*Sound->GetPathName());
+			}
+			return *Entry;
+		}
+	};
+
+	FAudioInstrumentation& GetInstrumentation()
+	{
+		static FAudioInstrumentation Instrumentation;
+		return Instrumentation;
+	}
+
+	/**
+	 * Request time of the play being dispatched from a queue or buffer, so the latency covers the
+	 * wait as well as the start. Zero means "now". Game thread only.
+	 */
+	uint64 GPendingRequestCycles = 0;
+
+	uint64 GetRequestCycles()
+	{
+		return GPendingRequestCycles != 0 ? GPendingRequestCycles : FPlatformTime::Cycles64();
+	}
+
+	/**
+	 * Stats for Sound through a small direct-mapped per-thread cache, so a repeat play is a hash and a
+	 * compare rather than the shared lock and map. FObjectKey keeps a recycled address from matching.
+	 */
+	FAudioSoundStats& FindSoundStats(const USoundBase* Sound)
+	{
+		struct FCachedStats
+		{
+			FObjectKey Key;
+			FAudioSoundStats* Stats = nullptr;
+		};
+		constexpr int32 NumCachedStats = 64;
+		thread_local FCachedStats Cache[NumCachedStats];
+
+		const FObjectKey Key(Sound);
+		FCachedStats& Cached = Cache[GetTypeHash(Key) & (NumCachedStats - 1)];
+		if (Cached.Stats == nullptr || Cached.Key != Key)
+		{
+			Cached.Key = Key;
+			Cached.Stats = &GetInstrumentation().FindOrAdd(Sound);
+		}
+		return *Cached.Stats;
+	}
+
+	void RecordSoundRequest(const USoundBase* Sound, ESoundRequestOutcome Outcome, uint64 RequestCycles, uint64 Count = 1)
+	{
+		if (Sound == nullptr || !CVarAudioInstrumentation.GetValueOnAnyThread())
+		{
+			return;
+		}
+
+		FAudioSoundStats& Stats = FindSoundStats(Sound);
+		const uint64 NowCycles = FPlatformTime::Cycles64();
+		const uint64 LatencyCycles = NowCycles > RequestCycles ? NowCycles - RequestCycles : 0;
+		const uint32 LatencyUs = static_cast<uint32>(FMath::Min<double>(FPlatformTime::ToSeconds64(LatencyCycles) * 1.0e6, MAX_uint32));
+
+		switch (Outcome)
+		{
+		case ESoundRequestOutcome::Started:
+		{
+			Stats.Plays.fetch_add(Count, std::memory_order_relaxed);
+			Stats.TotalLatencyCycles.fetch_add(LatencyCycles, std::memory_order_relaxed);
+			const int32 Bucket = LatencyUs == 0 ? 0 : FMath::Min(NumLatencyBuckets - 1, static_cast<int32>(FMath::FloorLog2(LatencyUs)) + 1);
+			Stats.LatencyHistogram[Bucket].fetch_add(1, std::memory_order_relaxed);
+			break;
+		}
+		case ESoundRequestOutcome::Culled:
+			Stats.Culls.fetch_add(Count, std::memory_order_relaxed);
+			break;
+		case ESoundRequestOutcome::Rejected:
+			Stats.Rejects.fetch_add(Count, std::memory_order_relaxed);
+			break;
+		case ESoundRequestOutcome::Merged:
+			Stats.Merges.fetch_add(Count, std::memory_order_relaxed);
+			break;
+		}
+
+		UE_TRACE_LOG(AudioManager, SoundRequest, AudioManagerChannel)
+			<< SoundRequest.Cycle(NowCycles)
+			<< SoundRequest.SoundId(Stats.SoundId)
+			<< SoundRequest.LatencyUs(LatencyUs)
+			<< SoundRequest.Outcome(static_cast<uint8>(Outcome))
+			<< SoundRequest.SoundName(*Stats.Name, Stats.Name.Len());
+	}
+
+	/** audio.SoundStats [N] [cost|reset] : top-N sounds by play count, or by total request-to-start time. */
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice AudioSoundStatsCommand(
+		TEXT("audio.SoundStats"),
+		TEXT("Prints the top-N sounds by play count. Args: [N] [cost|reset]."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+		{
+			int32 TopN = 20;
+			bool bByCost = false;
+			for (const FString& Arg : Args)
+			{
+				if (Arg == TEXT("reset"))
+				{
+					UAudioManager::ResetSoundStats();
+					return;
+				}
+				if (Arg == TEXT("cost"))
+				{
+					bByCost = true;
+				}
+				else if (Arg.IsNumeric())
+				{
+					TopN = FMath::Max(1, FCString::Atoi(*Arg));
+				}
+			}
+			UAudioManager::DumpSoundStats(Ar, TopN, bByCost);
+		}));
+}
+
+void UAudioManager::DumpSoundStats(FOutputDevice& Ar, int32 TopN, bool bByCost)
+{
+	FAudioInstrumentation& Instrumentation = GetInstrumentation();
+	FReadScopeLock ReadLock(Instrumentation.Lock);
+
+	TArray<const FAudioSoundStats*> Sorted;
+	Sorted.Reserve(Instrumentation.Stats.Num());
+	for (const TPair<FObjectKey, TUniquePtr<FAudioSoundStats>>& Pair : Instrumentation.Stats)
+	{
+		Sorted.Add(Pair.Value.Get());
+	}
+
+	Sorted.Sort([bByCost](const FAudioSoundStats& A, const FAudioSoundStats& B)
+	{
+		return bByCost
+			? A.TotalLatencyCycles.load(std::memory_order_relaxed) > B.TotalLatencyCycles.load(std::memory_order_relaxed)
+			: A.Plays.load(std::memory_order_relaxed) > B.Plays.load(std::memory_order_relaxed);
+	});
+
+	Ar.Logf(TEXT("%-40s %10s %10s %10s %10s %12s %12s  latency histogram (log2 us)"), TEXT("Sound"), TEXT("Plays"), TEXT("Culls"), TEXT("Rejects"), TEXT("Merges"), TEXT("Total ms"), TEXT("Mean us"));
+	for (int32 Index = 0; Index < FMath::Min(TopN, Sorted.Num()); ++Index)
+	{
+		const FAudioSoundStats& Stats = *Sorted[Index];
+		const uint64 Plays = Stats.Plays.load(std::memory_order_relaxed);
+		const double TotalMs = FPlatformTime::ToMilliseconds64(Stats.TotalLatencyCycles.load(std::memory_order_relaxed));
+
+		FString Histogram;
+		for (const std::atomic<uint32>& Bucket : Stats.LatencyHistogram)
+		{
+			Histogram += FString::Printf(TEXT(" %u"), Bucket.load(std::memory_order_relaxed));
+		}
+
+		Ar.Logf(TEXT("%-40s %10llu %10llu %10llu %10llu %12.3f %12.2f %s"),
+			*Stats.Name, Plays, Stats.Culls.load(std::memory_order_relaxed), Stats.Rejects.load(std::memory_order_relaxed),
+			Stats.Merges.load(std::memory_order_relaxed), TotalMs, Plays > 0 ? TotalMs * 1000.0 / Plays : 0.0, *Histogram);
+	}
+}
+
+void UAudioManager::ResetSoundStats()
+{
+	FAudioInstrumentation& Instrumentation = GetInstrumentation();
+	FReadScopeLock ReadLock(Instrumentation.Lock);
+	for (TPair<FObjectKey, TUniquePtr<FAudioSoundStats>>& Pair : Instrumentation.Stats)
+	{
+		Pair.Value->Reset();
+	}
+}
+
+#pragma endregion
+
+#pragma region VoicePool
+
+namespace
+{
+	// Defined in the Concurrency region; pooled voices count against the same limits as PlaySound.
+	bool AdmitVoice(EAudioCategory Category, const USoundBase* Sound, float Volume, uint8 Priority);
+	void TrackVoice(EAudioCategory Category, UAudioComponent* Component, const USoundBase* Sound, float Volume, uint8 Priority);
+	void UntrackVoice(const UAudioComponent* Component);
+}
+
+UAudioComponent* FAudioVoicePool::Play(UWorld* InWorld, USoundBase* Sound, float VolumeMultiplier, float PitchMultiplier, uint8 Priority)
+{
+	if (InWorld == nullptr || Sound == nullptr)
+	{
+		return nullptr;
+	}
+
+	const uint64 RequestCycles = GetRequestCycles();
+
+	// Admit before touching the pool so a rejected request never stops a voice.
+	if (!AdmitVoice(Category, Sound, VolumeMultiplier, Priority))
+	{
+		RecordSoundRequest(Sound, ESoundRequestOutcome::Rejected, RequestCycles);
+		return nullptr;
+	}
+
+	const int32 Index = AcquireVoice(InWorld, Sound);
+	if (Index == INDEX_NONE)
+	{
+		RecordSoundRequest(Sound, ESoundRequestOutcome::Rejected, RequestCycles);
+		return nullptr;
+	}
+
+	UAudioComponent* Voice = Voices[Index];
+	if (Voice->Sound != Sound)
+	{
+		Voice->SetSound(Sound);
+	}
+	Voice->SetVolumeMultiplier(VolumeMultiplier);
+	Voice->SetPitchMultiplier(PitchMultiplier);
+	Voice->Play();
+
+	StartTimes[Index] = FPlatformTime::Seconds();
+	TrackVoice(Category, Voice, Sound, VolumeMultiplier, Priority);
+	RecordSoundRequest(Sound, ESoundRequestOutcome::Started, RequestCycles);
+
+	return Voice;
+}
+
+UAudioComponent* FAudioVoicePool::PlayQuantized(UWorld* InWorld, USoundBase* Sound, UQuartzClockHandle* Clock, const FQuartzQuantizationBoundary& Boundary)
+{
+	if (InWorld == nullptr || Sound == nullptr || Clock == nullptr)
+	{
+		return nullptr;
+	}
+
+	const uint64 RequestCycles = GetRequestCycles();
+
+	if (!AdmitVoice(Category, Sound, 1.f, 128))
+	{
+		RecordSoundRequest(Sound, ESoundRequestOutcome::Rejected, RequestCycles);
+		return nullptr;
+	}
+
+	const int32 Index = AcquireVoice(InWorld, Sound);
+	if (Index == INDEX_NONE)
+	{
+		RecordSoundRequest(Sound, ESoundRequestOutcome::Rejected, RequestCycles);
+		return nullptr;
+	}
+
+	UAudioComponent* Voice = Voices[Index];
+	if (Voice->Sound != Sound)
+	{
+		Voice->SetSound(Sound);
+	}
+	Voice->SetVolumeMultiplier(1.f);
+	Voice->SetPitchMultiplier(1.f);
+
+	// The voice reports as playing while its command waits for the boundary, so the pool leaves it alone.
+	FQuartzQuantizationBoundary QueuedBoundary = Boundary;
+	Voice->PlayQuantized(InWorld, Clock, QueuedBoundary, FOnQuartzCommandEventBP());
+
+	StartTimes[Index] = FPlatformTime::Seconds();
+	TrackVoice(Category, Voice, Sound, 1.f, 128);
+
+	// Latency here is request-to-queue; the start itself is set by the clock.
+	RecordSoundRequest(Sound, ESoundRequestOutcome::Started, RequestCycles);
+
+	return Voice;
+}
+
+void FAudioVoicePool::Prewarm(UWorld* InWorld, USoundBase* Sound)
+{
+	if (InWorld == nullptr || Sound == nullptr)
+	{
+		return;
+	}
+
+	if (PoolWorld.Get() != InWorld)
+	{
+		Reset();
+		PoolWorld = InWorld;
+	}
+
+	while (Voices.Num() < Capacity)
+	{
+		if (CreateVoice(InWorld, Sound) == nullptr)
+		{
+			break;
+		}
+	}
+}
+
+void FAudioVoicePool::SetCapacity(int32 InCapacity)
+{
+	Capacity = FMath::Max(1, InCapacity);
+
+	while (Voices.Num() > Capacity)
+	{
+		StartTimes.Pop();
+		if (UAudioComponent* Voice = Voices.Pop())
+		{
+			Voice->Stop();
+			Voice->DestroyComponent();
+		}
+	}
+}
+
+void FAudioVoicePool::Reset()
+{
+	for (UAudioComponent* Voice : Voices)
+	{
+		if (IsValid(Voice))
+		{
+			Voice->Stop();
+			Voice->DestroyComponent();
+		}
+	}
+	Voices.Reset();
+	StartTimes.Reset();
+	PoolWorld.Reset();
+}
+
+void FAudioVoicePool::ReleaseWorld(const UWorld* World)
+{
+	// A stale weak pointer also counts: its voices are outered to a world that is already going away.
+	if (PoolWorld.Get() == World || (!PoolWorld.IsValid() && Voices.Num() > 0))
+	{
+		Reset();
+	}
+}
+
+void FAudioVoicePool::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(Voices);
+}
+
+int32 FAudioVoicePool::AcquireVoice(UWorld* InWorld, USoundBase* Sound)
+{
+	// Voices are registered with a specific world and cannot follow a level transition.
+	if (PoolWorld.Get() != InWorld)
+	{
+		Reset();
+		PoolWorld = InWorld;
+	}
+
+	for (int32 Index = 0; Index < Voices.Num(); ++Index)
+	{
+		UAudioComponent* Voice = Voices[Index];
+		if (IsValid(Voice) && !Voice->IsPlaying())
+		{
+			++PoolHits;
+			return Index;
+		}
+	}
+
+	++PoolMisses;
+
+	if (Voices.Num() < Capacity)
+	{
+		return CreateVoice(InWorld, Sound) ? Voices.Num() - 1 : INDEX_NONE;
+	}
+
+	// Every voice is busy: steal the one started longest ago.
+	int32 StealIndex = 0;
+	for (int32 Index = 1; Index < StartTimes.Num(); ++Index)
+	{
+		if (StartTimes[Index] < StartTimes[StealIndex])
+		{
+			StealIndex = Index;
+		}
+	}
+
+	UAudioComponent* Voice = Voices[StealIndex];
+	if (!IsValid(Voice))
+	{
+		Voices.RemoveAtSwap(StealIndex);
+		StartTimes.RemoveAtSwap(StealIndex);
+		return CreateVoice(InWorld, Sound) ? Voices.Num() - 1 : INDEX_NONE;
+	}
+
+	// The replay is tracked again by the caller; drop the entry for the cut-off sound.
+	UntrackVoice(Voice);
+	Voice->Stop();
+	return StealIndex;
+}
+
+UAudioComponent* FAudioVoicePool::CreateVoice(UWorld* InWorld, USoundBase* Sound)
+{
+	// bAutoDestroy is false so the component survives between shots.
+	UAudioComponent* Voice = UGameplayStatics::CreateSound2D(InWorld, Sound, 1.f, 1.f, 0.f, nullptr, false, false);
+	if (Voice == nullptr)
+	{
+#if DEV_DEBUG_MODE
+		LOG_ERROR("Failed to create a pooled audio component. Is audio disabled?");
+#endif
+		return nullptr;
+	}
+
+	Voices.Add(Voice);
+	StartTimes.Add(0.0);
+	return Voice;
+}
+
+#pragma endregion
 
 
 #pragma region AudioManager
@@ -15,6 +516,75 @@ UAudioManager::UAudioManager(const FObjectInitializer& ObjectInitializer)
 
 #pragma endregion
 
+#pragma region Initialization
+
+namespace
+{
+	struct FAudioInitStats
+	{
+		int32 Count = 0;
+		double TotalSeconds = 0.0;
+		double MaxSeconds = 0.0;
+	};
+
+	/** Per manager class; InitializeAudio only runs on the game thread */
+	TMap<FName, FAudioInitStats>& GetAudioInitStats()
+	{
+		static TMap<FName, FAudioInitStats> InitStats;
+		return InitStats;
+	}
+
+	/** audio.InitStats : initialization count and time per audio manager class. */
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice AudioInitStatsCommand(
+		TEXT("audio.InitStats"),
+		TEXT("Prints how many audio managers of each class were initialized and how long it took."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>&, UWorld*, FOutputDevice& Ar)
+		{
+			UAudioManager::DumpInitStats(Ar);
+		}));
+}
+
+void UAudioManager::InitializeAudio()
+{
+	// The CDO and archetypes only describe defaults; they never hold loaded sounds.
+	if (bAudioInitialized || HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		return;
+	}
+	check(IsInGameThread());
+
+	// Set first so a play call made while loading does not re-enter.
+	bAudioInitialized = true;
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UAudioManager::InitializeAudio);
+		OnInitializeAudio();
+	}
+	AudioInitSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+	FAudioInitStats& Stats = GetAudioInitStats().FindOrAdd(GetClass()->GetFName());
+	++Stats.Count;
+	Stats.TotalSeconds += AudioInitSeconds;
+	Stats.MaxSeconds = FMath::Max(Stats.MaxSeconds, AudioInitSeconds);
+
+#if DEV_DEBUG_MODE
+	LOG_INFO("Audio manager initialized.");
+#endif
+}
+
+void UAudioManager::DumpInitStats(FOutputDevice& Ar)
+{
+	Ar.Logf(TEXT("%-32s %6s %12s %12s"), TEXT("Manager"), TEXT("Count"), TEXT("Total ms"), TEXT("Max ms"));
+	for (const TPair<FName, FAudioInitStats>& Pair : GetAudioInitStats())
+	{
+		Ar.Logf(TEXT("%-32s %6d %12.3f %12.3f"), *Pair.Key.ToString(), Pair.Value.Count,
+			Pair.Value.TotalSeconds * 1000.0, Pair.Value.MaxSeconds * 1000.0);
+	}
+}
+
+#pragma endregion
+
 #pragma region WorldContext
 
 void UAudioManager::SetWorldContext(TObjectPtr<UObject> InWorld)
@@ -61,417 +631,3726 @@ TObjectPtr<UObject> UAudioManager::GetWorldContext() const
 
 #pragma endregion
 
-#pragma region PlaySound
+#pragma region Concurrency
 
-void UAudioManager::PlaySound(UObject* WorldContextObject, USoundBase* Sound)
+namespace
 {
-    if (!WorldContextObject)
-    {
-#if DEV_DEBUG_MODE
-        LOG_ERROR("PlaySound: WorldContextObject is NULL!");
-#endif
-    }
-    if (!Sound)
-    {
-#if DEV_DEBUG_MODE
-        LOG_ERROR("PlaySound: Sound is NULL!");
-#endif
-    }
+	/** A voice started through UAudioManager and still counted against its limits. */
+	struct FTrackedVoice
+	{
+		TWeakObjectPtr<UAudioComponent> Component;
+		FObjectKey Sound;
+		double StartTime;
+		float Volume;
+		uint8 Priority;
+	};
+
+	/** Game-thread bookkeeping for every voice started through UAudioManager. */
+	struct FAudioVoiceRegistry
+	{
+		FAudioCategoryConcurrency Categories[static_cast<int32>(EAudioCategory::Count)];
+		TArray<FTrackedVoice> Voices[static_cast<int32>(EAudioCategory::Count)];
+		TMap<FObjectKey, int32> SoundLimits;
+		int32 DefaultSoundLimit = 8;
+		uint64 StolenVoices = 0;
+		uint64 RejectedVoices = 0;
+
+		FAudioVoiceRegistry()
+		{
+			Categories[static_cast<int32>(EAudioCategory::UI)].MaxVoices = 16;
+			Categories[static_cast<int32>(EAudioCategory::Utility)].MaxVoices = 32;
+			Categories[static_cast<int32>(EAudioCategory::Character)].MaxVoices = 48;
+			Categories[static_cast<int32>(EAudioCategory::Environment)].MaxVoices = 24;
+			Categories[static_cast<int32>(EAudioCategory::Music)].MaxVoices = 4;
+
+			Categories[static_cast<int32>(EAudioCategory::UI)].StealPolicy = EVoiceStealPolicy::LowestPriority;
+			Categories[static_cast<int32>(EAudioCategory::Environment)].StealPolicy = EVoiceStealPolicy::Quietest;
+		}
+
+		static bool IsFinished(const FTrackedVoice& Voice)
+		{
+			const UAudioComponent* Component = Voice.Component.Get();
+			return Component == nullptr || !Component->IsPlaying();
+		}
+
+		/**
+		 * Picks the voice to stop among Candidates, or INDEX_NONE if the new request should give way.
+		 * Candidates index into List.
+		 */
+		static int32 PickVictim(const TArray<FTrackedVoice>& List, TConstArrayView<int32> Candidates, EVoiceStealPolicy Policy, float Volume, uint8 Priority)
+		{
+			int32 Victim = INDEX_NONE;
+			for (const int32 Index : Candidates)
+			{
+				const FTrackedVoice& Voice = List[Index];
+				if (Victim == INDEX_NONE)
+				{
+					Victim = Index;
+					continue;
+				}
+
+				const FTrackedVoice& Current = List[Victim];
+				switch (Policy)
+				{
+				case EVoiceStealPolicy::Oldest:
+					if (Voice.StartTime < Current.StartTime) { Victim = Index; }
+					break;
+				case EVoiceStealPolicy::Quietest:
+					if (Voice.Volume < Current.Volume) { Victim = Index; }
+					break;
+				case EVoiceStealPolicy::LowestPriority:
+					if (Voice.Priority < Current.Priority || (Voice.Priority == Current.Priority && Voice.StartTime < Current.StartTime)) { Victim = Index; }
+					break;
+				}
+			}
+
+			if (Victim != INDEX_NONE)
+			{
+				const FTrackedVoice& Current = List[Victim];
+				if ((Policy == EVoiceStealPolicy::Quietest && Volume < Current.Volume)
+					|| (Policy == EVoiceStealPolicy::LowestPriority && Priority < Current.Priority))
+				{
+					return INDEX_NONE;
+				}
+			}
+
+			return Victim;
+		}
+
+		void StopVoice(TArray<FTrackedVoice>& List, int32 Index)
+		{
+			if (UAudioComponent* Component = List[Index].Component.Get())
+			{
+				Component->Stop();
+			}
+			List.RemoveAtSwap(Index);
+			++StolenVoices;
+		}
+
+		/**
+		 * Makes room for a new voice of Sound in Category.
+		 * @return false if the request should be rejected.
+		 */
+		bool Admit(EAudioCategory Category, const USoundBase* Sound, float Volume, uint8 Priority)
+		{
+			const int32 CategoryIndex = static_cast<int32>(Category);
+			TArray<FTrackedVoice>& List = Voices[CategoryIndex];
+			const FAudioCategoryConcurrency& Rules = Categories[CategoryIndex];
+
+			List.RemoveAllSwap(&FAudioVoiceRegistry::IsFinished);
+
+			// Per-sound limit. A sound normally lives in a single category, so only that list is searched.
+			const FObjectKey SoundKey(Sound);
+			const int32* SoundLimit = SoundLimits.Find(SoundKey);
+			const int32 MaxInstances = SoundLimit ? *SoundLimit : DefaultSoundLimit;
+
+			TArray<int32, TInlineAllocator<16>> Instances;
+			for (int32 Index = 0; Index < List.Num(); ++Index)
+			{
+				if (List[Index].Sound == SoundKey)
+				{
+					Instances.Add(Index);
+				}
+			}
+
+			// Pick every victim before stopping any, so a request rejected by the category limit
+			// never costs a voice that the per-sound limit already stopped.
+			int32 SoundVictim = INDEX_NONE;
+			if (Instances.Num() >= MaxInstances)
+			{
+				SoundVictim = PickVictim(List, Instances, Rules.StealPolicy, Volume, Priority);
+				if (SoundVictim == INDEX_NONE)
+				{
+					++RejectedVoices;
+					return false;
+				}
+			}
+
+			// Per-category limit, counting the per-sound victim as already gone.
+			int32 CategoryVictim = INDEX_NONE;
+			if (List.Num() - (SoundVictim != INDEX_NONE ? 1 : 0) >= Rules.MaxVoices)
+			{
+				TArray<int32, TInlineAllocator<64>> Others;
+				for (int32 Index = 0; Index < List.Num(); ++Index)
+				{
+					if (Index != SoundVictim)
+					{
+						Others.Add(Index);
+					}
+				}
+
+				CategoryVictim = PickVictim(List, Others, Rules.StealPolicy, Volume, Priority);
+				if (CategoryVictim == INDEX_NONE)
+				{
+					++RejectedVoices;
+					return false;
+				}
+			}
+
+			// Stop the higher index first; RemoveAtSwap would otherwise move the other victim.
+			if (SoundVictim < CategoryVictim)
+			{
+				Swap(SoundVictim, CategoryVictim);
+			}
+			if (SoundVictim != INDEX_NONE)
+			{
+				StopVoice(List, SoundVictim);
+			}
+			if (CategoryVictim != INDEX_NONE)
+			{
+				StopVoice(List, CategoryVictim);
+			}
+
+			return true;
+		}
+
+		void Track(EAudioCategory Category, UAudioComponent* Component, const USoundBase* Sound, float Volume, uint8 Priority)
+		{
+			Voices[static_cast<int32>(Category)].Add({ Component, FObjectKey(Sound), FPlatformTime::Seconds(), Volume, Priority });
+		}
+	};
+
+	FAudioVoiceRegistry& GetVoiceRegistry()
+	{
+		static FAudioVoiceRegistry Registry;
+		return Registry;
+	}
+
+	bool AdmitVoice(EAudioCategory Category, const USoundBase* Sound, float Volume, uint8 Priority)
+	{
+		return GetVoiceRegistry().Admit(Category, Sound, Volume, Priority);
+	}
+
+	void TrackVoice(EAudioCategory Category, UAudioComponent* Component, const USoundBase* Sound, float Volume, uint8 Priority)
+	{
+		GetVoiceRegistry().Track(Category, Component, Sound, Volume, Priority);
+	}
+
+	void UntrackVoice(const UAudioComponent* Component)
+	{
+		for (TArray<FTrackedVoice>& List : GetVoiceRegistry().Voices)
+		{
+			List.RemoveAllSwap([Component](const FTrackedVoice& Voice) { return Voice.Component.Get() == Component; });
+		}
+	}
+
+	/** One pool of 2D voices per category, sized to the category's voice limit. */
+	class FCategoryVoicePools : public FGCObject
+	{
+	public:
+		FAudioVoicePool Pools[static_cast<int32>(EAudioCategory::Count)];
+
+		FCategoryVoicePools()
+		{
+			for (int32 CategoryIndex = 0; CategoryIndex < static_cast<int32>(EAudioCategory::Count); ++CategoryIndex)
+			{
+				Pools[CategoryIndex].Category = static_cast<EAudioCategory>(CategoryIndex);
+				Pools[CategoryIndex].SetCapacity(GetVoiceRegistry().Categories[CategoryIndex].MaxVoices);
+			}
+
+			// The pooled components are outered to their world; drop them with it so map travel and
+			// the end of PIE do not leave the old world reachable from this referencer.
+			FWorldDelegates::OnWorldCleanup.AddRaw(this, &FCategoryVoicePools::HandleWorldCleanup);
+		}
+
+		void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+		{
+			for (FAudioVoicePool& Pool : Pools)
+			{
+				Pool.ReleaseWorld(World);
+			}
+		}
+
+		virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+		{
+			for (FAudioVoicePool& Pool : Pools)
+			{
+				Pool.AddReferencedObjects(Collector);
+			}
+		}
+
+		virtual FString GetReferencerName() const override
+		{
+			return TEXT("UAudioManager::CategoryVoicePools");
+		}
+	};
+
+	FCategoryVoicePools& GetCategoryVoicePools()
+	{
+		static FCategoryVoicePools Pools;
+		return Pools;
+	}
+}
+
+void UAudioManager::SetCategoryConcurrency(EAudioCategory Category, const FAudioCategoryConcurrency& InConcurrency)
+{
+	check(Category < EAudioCategory::Count);
+
+	FAudioCategoryConcurrency& Rules = GetVoiceRegistry().Categories[static_cast<int32>(Category)];
+	Rules = InConcurrency;
+	Rules.MaxVoices = FMath::Max(1, Rules.MaxVoices);
+
+	GetCategoryVoicePools().Pools[static_cast<int32>(Category)].SetCapacity(Rules.MaxVoices);
+}
+
+FAudioCategoryConcurrency UAudioManager::GetCategoryConcurrency(EAudioCategory Category)
+{
+	check(Category < EAudioCategory::Count);
+	return GetVoiceRegistry().Categories[static_cast<int32>(Category)];
+}
+
+void UAudioManager::SetSoundConcurrencyLimit(const USoundBase* Sound, int32 MaxInstances)
+{
+	if (Sound == nullptr)
+	{
+		return;
+	}
+
+	if (MaxInstances <= 0)
+	{
+		GetVoiceRegistry().SoundLimits.Remove(FObjectKey(Sound));
+	}
+	else
+	{
+		GetVoiceRegistry().SoundLimits.Add(FObjectKey(Sound), MaxInstances);
+	}
+}
+
+void UAudioManager::SetDefaultSoundConcurrencyLimit(int32 MaxInstances)
+{
+	GetVoiceRegistry().DefaultSoundLimit = FMath::Max(1, MaxInstances);
+}
+
+int32 UAudioManager::GetActiveVoiceCount(EAudioCategory Category)
+{
+	check(Category < EAudioCategory::Count);
+
+	TArray<FTrackedVoice>& List = GetVoiceRegistry().Voices[static_cast<int32>(Category)];
+	List.RemoveAllSwap(&FAudioVoiceRegistry::IsFinished);
+	return List.Num();
+}
+
+uint64 UAudioManager::GetStolenVoiceCount()
+{
+	return GetVoiceRegistry().StolenVoices;
+}
+
+uint64 UAudioManager::GetRejectedVoiceCount()
+{
+	return GetVoiceRegistry().RejectedVoices;
+}
+
+#pragma endregion
+
+#pragma region Batching
+
+namespace
+{
+	/** A buffered Play request. */
+	struct FAudioPlayCommand
+	{
+		TWeakObjectPtr<UObject> WorldContext;
+		TWeakObjectPtr<USoundBase> Sound;
+		FVector Location;
+		float Volume;
+		EAudioCategory Category;
+		uint8 Priority;
+		bool bIs2D;
+		uint64 RequestCycles;
+	};
+
+	/** Identity used to merge requests issued in the same frame. */
+	struct FAudioPlayCommandKey
+	{
+		FObjectKey WorldContext;
+		FObjectKey Sound;
+		FIntVector Bucket;
+		EAudioCategory Category;
+		bool bIs2D;
+
+		bool operator==(const FAudioPlayCommandKey& Other) const
+		{
+			return Sound == Other.Sound
+				&& Bucket == Other.Bucket
+				&& WorldContext == Other.WorldContext
+				&& Category == Other.Category
+				&& bIs2D == Other.bIs2D;
+		}
+
+		friend uint32 GetTypeHash(const FAudioPlayCommandKey& Key)
+		{
+			uint32 Hash = HashCombineFast(GetTypeHash(Key.Sound), GetTypeHash(Key.Bucket));
+			Hash = HashCombineFast(Hash, GetTypeHash(Key.WorldContext));
+			return HashCombineFast(Hash, (static_cast<uint32>(Key.Category) << 1) | static_cast<uint32>(Key.bIs2D));
+		}
+	};
+
+	/** Per-frame command buffer shared by every manager. */
+	struct FAudioCommandBuffer
+	{
+		TArray<FAudioPlayCommand> Commands;
+		TMap<FAudioPlayCommandKey, int32> CommandIndices;
+		FTSTicker::FDelegateHandle TickHandle;
+		float BucketSize = 100.f;
+		float MaxMergedVolume = 2.f;
+		int32 LastFlushMerged = 0;
+		int32 PendingMerged = 0;
+		uint64 TotalMerged = 0;
+		bool bEnabled = false;
+
+		void Add(UObject* WorldContextObject, USoundBase* Sound, const FVector& Location, EAudioCategory Category, float Volume, uint8 Priority, bool bIs2D, uint64 RequestCycles)
+		{
+			FAudioPlayCommandKey Key;
+			Key.WorldContext = FObjectKey(WorldContextObject);
+			Key.Sound = FObjectKey(Sound);
+			Key.Bucket = bIs2D ? FIntVector::ZeroValue : FIntVector(
+				FMath::FloorToInt(Location.X / BucketSize),
+				FMath::FloorToInt(Location.Y / BucketSize),
+				FMath::FloorToInt(Location.Z / BucketSize));
+			Key.Category = Category;
+			Key.bIs2D = bIs2D;
+
+			if (const int32* Existing = CommandIndices.Find(Key))
+			{
+				// Summed-gain merge: the surviving voice is as loud as the requests combined, up to the cap.
+				FAudioPlayCommand& Command = Commands[*Existing];
+				Command.Volume = FMath::Min(Command.Volume + Volume, MaxMergedVolume);
+				Command.Priority = FMath::Max(Command.Priority, Priority);
+				++PendingMerged;
+				RecordSoundRequest(Sound, ESoundRequestOutcome::Merged, RequestCycles);
+				return;
+			}
+
+			CommandIndices.Add(Key, Commands.Num());
+			Commands.Add({ WorldContextObject, Sound, Location, Volume, Category, Priority, bIs2D, RequestCycles });
+		}
+	};
+
+	FAudioCommandBuffer& GetCommandBuffer()
+	{
+		static FAudioCommandBuffer Buffer;
+		return Buffer;
+	}
+
+	bool TickPlayCommands(float DeltaTime)
+	{
+		UAudioManager::FlushPlayCommands();
+		return true;
+	}
+
+	/** Starts a voice immediately, applying the concurrency limits. */
+	UAudioComponent* StartVoice(UObject* WorldContextObject, USoundBase* Sound, const FVector& Location, EAudioCategory Category, float VolumeMultiplier, uint8 Priority, bool bIs2D, uint64 RequestCycles)
+	{
+		// 2D voices have no per-request state, so they replay pooled components instead of
+		// allocating one per play. The pool admits and tracks the voice itself.
+		if (bIs2D)
+		{
+			UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+			if (World == nullptr)
+			{
+				return nullptr;
+			}
+
+			TGuardValue<uint64> RequestTimeGuard(GPendingRequestCycles, RequestCycles);
+			return GetCategoryVoicePools().Pools[static_cast<int32>(Category)].Play(World, Sound, VolumeMultiplier, 1.f, Priority);
+		}
+
+		FAudioVoiceRegistry& Registry = GetVoiceRegistry();
+		if (!Registry.Admit(Category, Sound, VolumeMultiplier, Priority))
+		{
+			RecordSoundRequest(Sound, ESoundRequestOutcome::Rejected, RequestCycles);
+			return nullptr;
+		}
+
+		// Positional voices still spawn a component per play so each keeps its own location.
+		UAudioComponent* Voice = UGameplayStatics::SpawnSoundAtLocation(WorldContextObject, Sound, Location, FRotator::ZeroRotator, VolumeMultiplier);
+
+		if (Voice)
+		{
+			Registry.Track(Category, Voice, Sound, VolumeMultiplier, Priority);
+			RecordSoundRequest(Sound, ESoundRequestOutcome::Started, RequestCycles);
+		}
+
+		return Voice;
+	}
+}
+
+void UAudioManager::SetFrameBatchingEnabled(bool bEnabled)
+{
+	FAudioCommandBuffer& Buffer = GetCommandBuffer();
+	if (Buffer.bEnabled == bEnabled)
+	{
+		return;
+	}
+
+	if (bEnabled)
+	{
+		Buffer.TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickPlayCommands));
+	}
+	else
+	{
+		FlushPlayCommands();
+		FTSTicker::GetCoreTicker().RemoveTicker(Buffer.TickHandle);
+		Buffer.TickHandle.Reset();
+	}
+
+	Buffer.bEnabled = bEnabled;
+}
+
+bool UAudioManager::IsFrameBatchingEnabled()
+{
+	return GetCommandBuffer().bEnabled;
+}
+
+void UAudioManager::SetFrameBatchBucketSize(float InBucketSize)
+{
+	GetCommandBuffer().BucketSize = FMath::Max(1.f, InBucketSize);
+}
+
+void UAudioManager::SetFrameBatchMaxMergedVolume(float InMaxVolume)
+{
+	GetCommandBuffer().MaxMergedVolume = FMath::Max(0.f, InMaxVolume);
+}
+
+int32 UAudioManager::FlushPlayCommands()
+{
+	FAudioCommandBuffer& Buffer = GetCommandBuffer();
+
+	// Swap out first: starting a voice must not append to the list being iterated.
+	TArray<FAudioPlayCommand> Commands = MoveTemp(Buffer.Commands);
+	Buffer.Commands.Reserve(Commands.Num());
+	Buffer.CommandIndices.Reset();
+
+	for (const FAudioPlayCommand& Command : Commands)
+	{
+		UObject* WorldContextObject = Command.WorldContext.Get();
+		USoundBase* Sound = Command.Sound.Get();
+		if (WorldContextObject && Sound)
+		{
+			StartVoice(WorldContextObject, Sound, Command.Location, Command.Category, Command.Volume, Command.Priority, Command.bIs2D, Command.RequestCycles);
+		}
+	}
+
+	Buffer.LastFlushMerged = Buffer.PendingMerged;
+	Buffer.TotalMerged += Buffer.PendingMerged;
+	Buffer.PendingMerged = 0;
+
+#if DEV_DEBUG_MODE
+	if (Buffer.LastFlushMerged > 0)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("FlushPlayCommands: started %d voices, merged %d requests."), Commands.Num(), Buffer.LastFlushMerged);
+	}
+#endif
+
+	return Buffer.LastFlushMerged;
+}
+
+int32 UAudioManager::GetLastFlushMergedCount()
+{
+	return GetCommandBuffer().LastFlushMerged;
+}
+
+uint64 UAudioManager::GetTotalMergedCount()
+{
+	return GetCommandBuffer().TotalMerged;
+}
+
+#pragma endregion
+
+#pragma region ThreadSafe
+
+namespace
+{
+	/**
+	 * Bounded lock-free multi-producer / single-consumer ring.
+	 * Each cell carries a sequence number that tells producers and the consumer whose turn it is.
+	 */
+	template <typename ElementType, uint32 Capacity>
+	class TBoundedMpscQueue
+	{
+		static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+		struct FCell
+		{
+			std::atomic<uint32> Sequence;
+			ElementType Data;
+		};
+
+		FCell Cells[Capacity];
+		alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> EnqueuePos;
+		alignas(PLATFORM_CACHE_LINE_SIZE) uint32 DequeuePos;
+
+	public:
+		TBoundedMpscQueue()
+		: EnqueuePos(0)
+		, DequeuePos(0)
+		{
+			for (uint32 Index = 0; Index < Capacity; ++Index)
+			{
+				Cells[Index].Sequence.store(Index, std::memory_order_relaxed);
+			}
+		}
+
+		/** Any thread. Returns false if the queue is full. */
+		bool Enqueue(const ElementType& Item)
+		{
+			uint32 Pos = EnqueuePos.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				FCell& Cell = Cells[Pos & (Capacity - 1)];
+				const uint32 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+				const int32 Diff = static_cast<int32>(Sequence - Pos);
+
+				if (Diff == 0)
+				{
+					if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+					{
+						Cell.Data = Item;
+						Cell.Sequence.store(Pos + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (Diff < 0)
+				{
+					return false;
+				}
+				else
+				{
+					Pos = EnqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/** Consumer thread only. Returns false if the queue is empty. */
+		bool Dequeue(ElementType& OutItem)
+		{
+			FCell& Cell = Cells[DequeuePos & (Capacity - 1)];
+			const uint32 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+			if (static_cast<int32>(Sequence - (DequeuePos + 1)) < 0)
+			{
+				return false;
+			}
+
+			OutItem = Cell.Data;
+			Cell.Sequence.store(DequeuePos + Capacity, std::memory_order_release);
+			++DequeuePos;
+			return true;
+		}
+	};
+
+	bool TickPlayRequests(float DeltaTime)
+	{
+		UAudioManager::DrainPlayRequests();
+		return true;
+	}
+
+	/** Cross-thread request queue plus its overflow counters. */
+	struct FAudioPlayRequestQueue
+	{
+		TBoundedMpscQueue<FAudioPlayRequest, AudioPlayRequestQueueCapacity> Queue;
+		std::atomic<uint64> DroppedRequests{ 0 };
+		int32 PeakRequests = 0;
+
+		FAudioPlayRequestQueue()
+		{
+			// FTSTicker is thread-safe, so the first producer may register the drain from any thread.
+			FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickPlayRequests));
+		}
+	};
+
+	FAudioPlayRequestQueue& GetPlayRequestQueue()
+	{
+		static FAudioPlayRequestQueue Queue;
+		return Queue;
+	}
+}
+
+bool UAudioManager::EnqueuePlayRequest(const FAudioPlayRequest& Request)
+{
+	FAudioPlayRequest Stamped = Request;
+	if (Stamped.RequestCycles == 0)
+	{
+		Stamped.RequestCycles = FPlatformTime::Cycles64();
+	}
+
+	FAudioPlayRequestQueue& RequestQueue = GetPlayRequestQueue();
+	if (!RequestQueue.Queue.Enqueue(Stamped))
+	{
+		RequestQueue.DroppedRequests.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	return true;
+}
+
+int32 UAudioManager::DrainPlayRequests()
+{
+	check(IsInGameThread());
+
+	FAudioPlayRequestQueue& RequestQueue = GetPlayRequestQueue();
+
+	// Bounded so producers that keep pushing during the drain cannot stall this frame.
+	int32 NumDrained = 0;
+	FAudioPlayRequest Request;
+	while (NumDrained < static_cast<int32>(AudioPlayRequestQueueCapacity) && RequestQueue.Queue.Dequeue(Request))
+	{
+		++NumDrained;
+
+		UObject* WorldContextObject = Request.WorldContext.Get();
+		USoundBase* Sound = Cast<USoundBase>(Request.Sound.Get());
+		if (WorldContextObject == nullptr || Sound == nullptr)
+		{
+			continue;
+		}
+
+		// Charge the time spent in the queue to this request's latency.
+		TGuardValue<uint64> RequestTimeGuard(GPendingRequestCycles, Request.RequestCycles);
+
+		if (Request.bIs2D)
+		{
+			PlaySound(WorldContextObject, Sound, Request.Category, Request.VolumeMultiplier, Request.Priority);
+		}
+		else
+		{
+			PlaySoundAtLocation(WorldContextObject, Sound, Request.Location, Request.Category, Request.VolumeMultiplier, Request.Priority);
+		}
+	}
+
+	RequestQueue.PeakRequests = FMath::Max(RequestQueue.PeakRequests, NumDrained);
+	return NumDrained;
+}
+
+uint64 UAudioManager::GetDroppedPlayRequestCount()
+{
+	return GetPlayRequestQueue().DroppedRequests.load(std::memory_order_relaxed);
+}
+
+int32 UAudioManager::GetPeakPlayRequestCount()
+{
+	return GetPlayRequestQueue().PeakRequests;
+}
+
+#pragma endregion
+
+#pragma region Culling
+
+namespace
+{
+	/**
+	 * Per-frame snapshot of the listener positions of one world, bucketed into a uniform grid.
+	 * Positions are stored relative to the first listener so they stay precise as floats.
+	 */
+	struct FListenerGrid
+	{
+		TWeakObjectPtr<UWorld> World;
+		uint64 BuiltFrame = MAX_uint64;
+		float CellSize = 5000.f;
+		bool bEnabled = true;
+
+		/** Largest cell radius IsAudible probes; 17^3 cells already exceeds any local player count. */
+		static constexpr double MaxProbeReach = 8.0;
+		uint64 CulledSounds = 0;
+
+		FVector Origin = FVector::ZeroVector;
+		TArray<FVector3f> Listeners;
+		TMap<FIntVector, TArray<int32, TInlineAllocator<4>>> Cells;
+
+		FIntVector CellOf(const FVector3f& Position) const
+		{
+			return FIntVector(
+				FMath::FloorToInt(Position.X / CellSize),
+				FMath::FloorToInt(Position.Y / CellSize),
+				FMath::FloorToInt(Position.Z / CellSize));
+		}
+
+		void Refresh(UWorld* InWorld)
+		{
+			if (World.Get() == InWorld && BuiltFrame == GFrameCounter)
+			{
+				return;
+			}
+
+			World = InWorld;
+			BuiltFrame = GFrameCounter;
+			Listeners.Reset();
+			Cells.Reset();
+
+			bool bHasOrigin = false;
+			for (FConstPlayerControllerIterator It = InWorld->GetPlayerControllerIterator(); It; ++It)
+			{
+				const APlayerController* PlayerController = It->Get();
+				if (PlayerController == nullptr || !PlayerController->IsLocalController())
+				{
+					continue;
+				}
+
+				FVector Location;
+				FVector FrontDir;
+				FVector RightDir;
+				PlayerController->GetAudioListenerPosition(Location, FrontDir, RightDir);
+
+				if (!bHasOrigin)
+				{
+					Origin = Location;
+					bHasOrigin = true;
+				}
+
+				const FVector3f Relative(Location - Origin);
+				Cells.FindOrAdd(CellOf(Relative)).Add(Listeners.Add(Relative));
+			}
+		}
+
+		/** Squared distance to the closest listener, or MAX_flt when there is none. */
+		float GetNearestDistanceSquared(const FVector& Location) const
+		{
+			const FVector3f Relative(Location - Origin);
+			float Nearest = MAX_flt;
+			for (const FVector3f& Listener : Listeners)
+			{
+				Nearest = FMath::Min(Nearest, FVector3f::DistSquared(Listener, Relative));
+			}
+			return Nearest;
+		}
+
+		bool IsAudible(const FVector& Location, float MaxDistance) const
+		{
+			// No listener known: never cull rather than silence everything.
+			if (Listeners.Num() == 0)
+			{
+				return true;
+			}
+
+			const FVector3f Relative(Location - Origin);
+			const float RadiusSq = FMath::Square(MaxDistance);
+
+			// Computed in double so a huge MaxDistance cannot overflow the cell count; past MaxProbeReach
+			// the probe volume dwarfs any realistic listener count, so the scan below is used instead.
+			const double ReachCells = FMath::CeilToDouble(static_cast<double>(MaxDistance) / CellSize);
+			const bool bProbeCells = ReachCells <= MaxProbeReach;
+			const int32 Reach = bProbeCells ? FMath::Max(0, static_cast<int32>(ReachCells)) : 0;
+			const int64 CellsToProbe = FMath::Cube(2 * static_cast<int64>(Reach) + 1);
+
+			// With few listeners a straight scan is cheaper than probing the neighbouring cells.
+			if (!bProbeCells || CellsToProbe >= Listeners.Num())
+			{
+				for (const FVector3f& Listener : Listeners)
+				{
+					if (FVector3f::DistSquared(Listener, Relative) <= RadiusSq)
+					{
+						return true;
+					}
+				}
+				return false;
+			}
+
+			const FIntVector Center = CellOf(Relative);
+			for (int32 X = -Reach; X <= Reach; ++X)
+			{
+				for (int32 Y = -Reach; Y <= Reach; ++Y)
+				{
+					for (int32 Z = -Reach; Z <= Reach; ++Z)
+					{
+						if (const TArray<int32, TInlineAllocator<4>>* Cell = Cells.Find(Center + FIntVector(X, Y, Z)))
+						{
+							for (const int32 Index : *Cell)
+							{
+								if (FVector3f::DistSquared(Listeners[Index], Relative) <= RadiusSq)
+								{
+									return true;
+								}
+							}
+						}
+					}
+				}
+			}
+			return false;
+		}
+	};
+
+	FListenerGrid& GetListenerGrid()
+	{
+		static FListenerGrid Grid;
+		return Grid;
+	}
+
+	/** Returns the cull radius for Sound, or a negative value if it must never be culled. */
+	float GetCullDistance(const USoundBase* Sound)
+	{
+		// Looping sounds would never come back once culled; those belong to the virtual voice system.
+		if (Sound == nullptr || Sound->IsLooping())
+		{
+			return -1.f;
+		}
+
+		const float MaxDistance = Sound->GetMaxDistance();
+		return MaxDistance < WORLD_MAX * 0.5f ? MaxDistance : -1.f;
+	}
+
+	/** Cheap pre-engine test used by PlaySoundAtLocation. */
+	bool PassesDistanceCull(UObject* WorldContextObject, const USoundBase* Sound, const FVector& Location)
+	{
+		FListenerGrid& Grid = GetListenerGrid();
+		if (!Grid.bEnabled)
+		{
+			return true;
+		}
+
+		const float MaxDistance = GetCullDistance(Sound);
+		if (MaxDistance < 0.f)
+		{
+			return true;
+		}
+
+		UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+		if (World == nullptr)
+		{
+			return true;
+		}
+
+		Grid.Refresh(World);
+		if (Grid.IsAudible(Location, MaxDistance))
+		{
+			return true;
+		}
+
+		++Grid.CulledSounds;
+		RecordSoundRequest(Sound, ESoundRequestOutcome::Culled, GetRequestCycles());
+		return false;
+	}
+
+	/** Hands a positional request that survived culling to the batch buffer or starts it directly. */
+	UAudioComponent* DispatchAtLocation(UObject* WorldContextObject, USoundBase* Sound, const FVector& Location, EAudioCategory Category, float VolumeMultiplier, uint8 Priority)
+	{
+		const uint64 RequestCycles = GetRequestCycles();
+
+		FAudioCommandBuffer& Buffer = GetCommandBuffer();
+		if (Buffer.bEnabled)
+		{
+			Buffer.Add(WorldContextObject, Sound, Location, Category, VolumeMultiplier, Priority, false, RequestCycles);
+			return nullptr;
+		}
+
+		return StartVoice(WorldContextObject, Sound, Location, Category, VolumeMultiplier, Priority, false, RequestCycles);
+	}
+}
+
+void UAudioManager::SetDistanceCullingEnabled(bool bEnabled)
+{
+	GetListenerGrid().bEnabled = bEnabled;
+}
+
+void UAudioManager::SetListenerGridCellSize(float InCellSize)
+{
+	FListenerGrid& Grid = GetListenerGrid();
+	Grid.CellSize = FMath::Max(100.f, InCellSize);
+	Grid.BuiltFrame = MAX_uint64;
+}
+
+bool UAudioManager::IsLocationAudible(UObject* WorldContextObject, const USoundBase* Sound, const FVector& Location)
+{
+	const float MaxDistance = GetCullDistance(Sound);
+	if (MaxDistance < 0.f)
+	{
+		return true;
+	}
+
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	if (World == nullptr)
+	{
+		return true;
+	}
+
+	FListenerGrid& Grid = GetListenerGrid();
+	Grid.Refresh(World);
+	return Grid.IsAudible(Location, MaxDistance);
+}
+
+int32 UAudioManager::CullInaudibleLocations(UObject* WorldContextObject, const USoundBase* Sound, TArrayView<const FVector> Locations, TArray<int32>& OutAudibleIndices)
+{
+	OutAudibleIndices.Reset(Locations.Num());
+
+	const float MaxDistance = GetCullDistance(Sound);
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+
+	FListenerGrid& Grid = GetListenerGrid();
+	if (World)
+	{
+		Grid.Refresh(World);
+	}
+
+	if (MaxDistance < 0.f || World == nullptr || !Grid.bEnabled || Grid.Listeners.Num() == 0)
+	{
+		for (int32 Index = 0; Index < Locations.Num(); ++Index)
+		{
+			OutAudibleIndices.Add(Index);
+		}
+		return 0;
+	}
+
+	const VectorRegister4Float RadiusSq = VectorSetFloat1(FMath::Square(MaxDistance));
+
+	for (int32 Base = 0; Base < Locations.Num(); Base += 4)
+	{
+		const int32 NumLanes = FMath::Min(4, Locations.Num() - Base);
+
+		// Transpose four locations into X/Y/Z lanes. Unused lanes are parked out of range.
+		alignas(16) float Xs[4] = { MAX_flt, MAX_flt, MAX_flt, MAX_flt };
+		alignas(16) float Ys[4] = { 0.f, 0.f, 0.f, 0.f };
+		alignas(16) float Zs[4] = { 0.f, 0.f, 0.f, 0.f };
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			const FVector3f Relative(Locations[Base + Lane] - Grid.Origin);
+			Xs[Lane] = Relative.X;
+			Ys[Lane] = Relative.Y;
+			Zs[Lane] = Relative.Z;
+		}
+
+		const VectorRegister4Float X = VectorLoadAligned(Xs);
+		const VectorRegister4Float Y = VectorLoadAligned(Ys);
+		const VectorRegister4Float Z = VectorLoadAligned(Zs);
+
+		VectorRegister4Float InRange = VectorZeroFloat();
+		for (const FVector3f& Listener : Grid.Listeners)
+		{
+			const VectorRegister4Float DX = VectorSubtract(X, VectorSetFloat1(Listener.X));
+			const VectorRegister4Float DY = VectorSubtract(Y, VectorSetFloat1(Listener.Y));
+			const VectorRegister4Float DZ = VectorSubtract(Z, VectorSetFloat1(Listener.Z));
+			const VectorRegister4Float DistSq = VectorMultiplyAdd(DX, DX, VectorMultiplyAdd(DY, DY, VectorMultiply(DZ, DZ)));
+			InRange = VectorBitwiseOr(InRange, VectorCompareLE(DistSq, RadiusSq));
+		}
+
+		const uint32 Mask = static_cast<uint32>(VectorMaskBits(InRange));
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			if (Mask & (1u << Lane))
+			{
+				OutAudibleIndices.Add(Base + Lane);
+			}
+		}
+	}
+
+	const int32 NumCulled = Locations.Num() - OutAudibleIndices.Num();
+	Grid.CulledSounds += NumCulled;
+	if (NumCulled > 0)
+	{
+		RecordSoundRequest(Sound, ESoundRequestOutcome::Culled, GetRequestCycles(), NumCulled);
+	}
+	return NumCulled;
+}
+
+int32 UAudioManager::PlaySoundAtLocations(UObject* WorldContextObject, USoundBase* Sound, TArrayView<const FVector> Locations, EAudioCategory Category, float VolumeMultiplier, uint8 Priority)
+{
+	if (!WorldContextObject || !Sound)
+	{
+#if DEV_DEBUG_MODE
+		LOG_ERROR("PlaySoundAtLocations: WorldContextObject or Sound is NULL!");
+#endif
+		return 0;
+	}
+
+	TArray<int32> AudibleIndices;
+	CullInaudibleLocations(WorldContextObject, Sound, Locations, AudibleIndices);
+
+	// Already culled as a batch, so go straight to dispatch.
+	for (const int32 Index : AudibleIndices)
+	{
+		DispatchAtLocation(WorldContextObject, Sound, Locations[Index], Category, VolumeMultiplier, Priority);
+	}
+
+	return AudibleIndices.Num();
+}
+
+uint64 UAudioManager::GetCulledSoundCount()
+{
+	return GetListenerGrid().CulledSounds;
+}
+
+#pragma endregion
+
+#pragma region PlaySound
+
+UAudioComponent* UAudioManager::PlaySound(UObject* WorldContextObject, USoundBase* Sound, EAudioCategory Category, float VolumeMultiplier, uint8 Priority)
+{
+    if (!WorldContextObject)
+    {
+#if DEV_DEBUG_MODE
+        LOG_ERROR("PlaySound: WorldContextObject is NULL!");
+#endif
+        return nullptr;
+    }
+    if (!Sound)
+    {
+#if DEV_DEBUG_MODE
+        LOG_ERROR("PlaySound: Sound is NULL!");
+#endif
+        return nullptr;
+    }
+
+    TRACE_CPUPROFILER_EVENT_SCOPE(UAudioManager::PlaySound);
+
+    const uint64 RequestCycles = GetRequestCycles();
+
+    FAudioCommandBuffer& Buffer = GetCommandBuffer();
+    if (Buffer.bEnabled)
+    {
+        Buffer.Add(WorldContextObject, Sound, FVector::ZeroVector, Category, VolumeMultiplier, Priority, true, RequestCycles);
+        return nullptr;
+    }
+
+    return StartVoice(WorldContextObject, Sound, FVector::ZeroVector, Category, VolumeMultiplier, Priority, true, RequestCycles);
+}
+
+UAudioComponent* UAudioManager::PlaySoundAtLocation(UObject* WorldContextObject, USoundBase* Sound, FVector Location, EAudioCategory Category, float VolumeMultiplier, uint8 Priority)
+{
+	if (!WorldContextObject)
+	{
+#if DEV_DEBUG_MODE
+		LOG_ERROR("PlaySoundAtLocation: WorldContextObject is NULL!");
+#endif
+		return nullptr;
+	}
+	if (!Sound)
+	{
+#if DEV_DEBUG_MODE
+		LOG_ERROR("PlaySoundAtLocation: Sound is NULL!");
+#endif
+		return nullptr;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UAudioManager::PlaySoundAtLocation);
+
+	// Drop requests that no listener can hear before they cost an engine round-trip.
+	if (!PassesDistanceCull(WorldContextObject, Sound, Location))
+	{
+		return nullptr;
+	}
+
+	return DispatchAtLocation(WorldContextObject, Sound, Location, Category, VolumeMultiplier, Priority);
+}
+
+#pragma endregion
+
+#pragma endregion
+
+#pragma region SoundCache
+
+namespace
+{
+	/** True while a voice started through UAudioManager is playing Sound. */
+	bool IsTrackedVoicePlaying(const USoundBase* Sound)
+	{
+		const FObjectKey SoundKey(Sound);
+		for (const TArray<FTrackedVoice>& List : GetVoiceRegistry().Voices)
+		{
+			for (const FTrackedVoice& Voice : List)
+			{
+				if (Voice.Sound == SoundKey && !FAudioVoiceRegistry::IsFinished(Voice))
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * Conservative "might still be audible" test. Every play fetches its sound through the cache
+	 * right before starting it, so a one-shot used more recently than its duration may still be running.
+	 */
+	bool MayBePlaying(const USoundBase* Sound, double LastUseTime, double Now)
+	{
+		const float Duration = Sound->GetDuration();
+		if (Duration < INDEFINITELY_LOOPING_DURATION && Now - LastUseTime < Duration)
+		{
+			return true;
+		}
+		return IsTrackedVoicePlaying(Sound);
+	}
+}
+
+FSoundAssetCache& FSoundAssetCache::Get()
+{
+	static FSoundAssetCache Cache;
+	return Cache;
+}
+
+FSoundAssetCache::FSoundAssetCache()
+{
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSoundAssetCache::Tick));
+}
+
+FSoundAssetCache::~FSoundAssetCache()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+}
+
+FSoftObjectPath FSoundAssetCache::ResolvePath(uint64 Id, const TCHAR* FallbackPath)
+{
+	if (const FSoundManifestEntry* Entry = FSoundManifest::Get().Find(Id))
+	{
+		return Entry->Path;
+	}
+	return FallbackPath ? FSoftObjectPath(FallbackPath) : FSoftObjectPath();
+}
+
+int32 FSoundAssetCache::FindOrAddSlot(uint64 Id)
+{
+	if (const int32* Slot = SlotsById.Find(Id))
+	{
+		return *Slot;
+	}
+
+	const int32 Slot = Entries.AddDefaulted();
+	Entries[Slot].Id = Id;
+	SlotsById.Add(Id, Slot);
+	return Slot;
+}
+
+USoundBase* FSoundAssetCache::HandleMiss(int32 Slot, const TCHAR* FallbackPath)
+{
+	++Misses;
+
+	const FSoftObjectPath Path = ResolvePath(Entries[Slot].Id, FallbackPath);
+	if (Path.IsNull())
+	{
+		return nullptr;
+	}
+
+	// Still in memory (e.g. evicted but not yet collected): take it back without a load.
+	if (USoundBase* Sound = Cast<USoundBase>(Path.ResolveObject()))
+	{
+		SetSlotSound(Slot, Sound);
+		return Sound;
+	}
+
+	StartLoad(Slot, Path);
+
+#if DEV_DEBUG_MODE
+	LOG_INFO("FSoundAssetCache: sound is not resident, play dropped while it streams in.");
+#endif
+	return nullptr;
+}
+
+void FSoundAssetCache::Prefetch(uint64 Id, const TCHAR* FallbackPath)
+{
+	const int32 Slot = FindOrAddSlot(Id);
+	if (Entries[Slot].Sound != nullptr || Entries[Slot].bLoading)
+	{
+		return;
+	}
+
+	const FSoftObjectPath Path = ResolvePath(Id, FallbackPath);
+	if (USoundBase* Sound = Cast<USoundBase>(Path.ResolveObject()))
+	{
+		SetSlotSound(Slot, Sound);
+	}
+	else if (!Path.IsNull())
+	{
+		StartLoad(Slot, Path);
+	}
+}
+
+void FSoundAssetCache::StartLoad(int32 Slot, const FSoftObjectPath& Path)
+{
+	if (Entries[Slot].bLoading)
+	{
+		return;
+	}
+	Entries[Slot].bLoading = true;
+
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		Path,
+		FStreamableDelegate::CreateLambda([this, Slot, Path]()
+		{
+			FEntry& Entry = Entries[Slot];
+			Entry.bLoading = false;
+			Entry.LoadHandle.Reset();
+			SetSlotSound(Slot, Cast<USoundBase>(Path.ResolveObject()));
+		}),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	// The delegate may already have run if the request completed synchronously.
+	if (Entries[Slot].bLoading)
+	{
+		if (Handle.IsValid())
+		{
+			Entries[Slot].LoadHandle = MoveTemp(Handle);
+		}
+		else
+		{
+			Entries[Slot].bLoading = false;
+		}
+	}
+}
+
+void FSoundAssetCache::AddSound(uint64 Id, USoundBase* Sound)
+{
+	SetSlotSound(FindOrAddSlot(Id), Sound);
+}
+
+void FSoundAssetCache::SetSlotSound(int32 Slot, USoundBase* Sound)
+{
+	if (Sound == nullptr)
+	{
+		return;
+	}
+
+	FEntry& Entry = Entries[Slot];
+	ResidentBytes -= Entry.Bytes;
+
+	Entry.Sound = Sound;
+	Entry.Bytes = static_cast<int64>(Sound->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal));
+	Entry.LastUseFrame = GFrameCounter;
+	Entry.LastUseTime = FPlatformTime::Seconds();
+
+	// Over-budget sounds are dropped by the next per-frame pass, never inside a play call.
+	ResidentBytes += Entry.Bytes;
+
+	// Register the stats entry now, with the ID already at hand, so the first play skips GetPathName.
+	if (CVarAudioInstrumentation.GetValueOnGameThread())
+	{
+		GetInstrumentation().FindOrAdd(Sound, Entry.Id);
+	}
+}
+
+void FSoundAssetCache::Pin(uint64 Id)
+{
+	++Entries[FindOrAddSlot(Id)].PinCount;
+}
+
+void FSoundAssetCache::Unpin(uint64 Id)
+{
+	if (const int32* Slot = SlotsById.Find(Id))
+	{
+		FEntry& Entry = Entries[*Slot];
+		Entry.PinCount = FMath::Max(0, Entry.PinCount - 1);
+	}
+}
+
+void FSoundAssetCache::SetBudgetBytes(int64 InBudgetBytes)
+{
+	BudgetBytes = FMath::Max<int64>(0, InBudgetBytes);
+	EnforceBudget();
+}
+
+bool FSoundAssetCache::Tick(float DeltaTime)
+{
+	// Turn this frame's hit stamps into times for the LRU order and MayBePlaying.
+	const double Now = FPlatformTime::Seconds();
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.Sound != nullptr && Entry.LastUseFrame >= LastTickFrame)
+		{
+			Entry.LastUseTime = Now;
+		}
+	}
+	LastTickFrame = GFrameCounter;
+
+	EnforceBudget();
+	return true;
+}
+
+void FSoundAssetCache::EnforceBudget()
+{
+	if (ResidentBytes <= BudgetBytes)
+	{
+		return;
+	}
+
+	// Oldest first, so the scan below stops as soon as the budget is met.
+	TArray<TPair<double, int32>> Candidates;
+	Candidates.Reserve(Entries.Num());
+	for (int32 Slot = 0; Slot < Entries.Num(); ++Slot)
+	{
+		const FEntry& Entry = Entries[Slot];
+		if (Entry.Sound != nullptr && Entry.PinCount == 0 && Entry.LastUseFrame != GFrameCounter)
+		{
+			Candidates.Emplace(Entry.LastUseTime, Slot);
+		}
+	}
+	Candidates.Sort([](const TPair<double, int32>& A, const TPair<double, int32>& B) { return A.Key < B.Key; });
+
+	// The newest candidates form the hot set and are never evicted.
+	const int32 NumEvictable = FMath::Max(0, Candidates.Num() - HotSetSize);
+
+	const double Now = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumEvictable; ++Index)
+	{
+		const TPair<double, int32>& Candidate = Candidates[Index];
+		if (ResidentBytes <= BudgetBytes)
+		{
+			break;
+		}
+
+		// The slot stays so indices held by FCachedSound remain valid; only the reference goes.
+		FEntry& Entry = Entries[Candidate.Value];
+		if (MayBePlaying(Entry.Sound, Entry.LastUseTime, Now))
+		{
+			continue;
+		}
+
+		ResidentBytes -= Entry.Bytes;
+		Entry.Sound = nullptr;
+		Entry.Bytes = 0;
+		++Evictions;
+	}
+
+#if DEV_DEBUG_MODE
+	if (ResidentBytes > BudgetBytes)
+	{
+		LOG_INFO("FSoundAssetCache: over budget, remaining sounds are pinned or playing.");
+	}
+#endif
+}
+
+void FSoundAssetCache::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (FEntry& Entry : Entries)
+	{
+		Collector.AddReferencedObject(Entry.Sound);
+	}
+}
+
+#pragma endregion
+
+#pragma region Manifest
+
+namespace
+{
+	void SerializeManifestEntry(FArchive& Ar, FSoundManifestEntry& Entry)
+	{
+		FString PathString = Entry.Path.ToString();
+		uint8 Category = static_cast<uint8>(Entry.Category);
+
+		Ar << Entry.Id;
+		Ar << PathString;
+		Ar << Entry.Duration;
+		Ar << Entry.NumChannels;
+		Ar << Category;
+
+		if (Ar.IsLoading())
+		{
+			Entry.Path = FSoftObjectPath(PathString);
+			Entry.Category = static_cast<EAudioCategory>(FMath::Min<uint8>(Category, static_cast<uint8>(EAudioCategory::Count) - 1));
+		}
+	}
+}
+
+FSoundManifest& FSoundManifest::Get()
+{
+	static FSoundManifest Manifest;
+	return Manifest;
+}
+
+FString FSoundManifest::GetManifestPath()
+{
+	return FPaths::ProjectContentDir() / TEXT("Audio/SoundManifest.bin");
+}
+
+FSoundManifest::FSoundManifest()
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetManifestPath(), FILEREAD_Silent))
+	{
+		return;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 FileMagic = 0;
+	uint32 FileVersion = 0;
+	Reader << FileMagic;
+	Reader << FileVersion;
+	if (FileMagic != Magic || FileVersion != Version)
+	{
+#if DEV_DEBUG_MODE
+		LOG_ERROR("FSoundManifest: manifest header mismatch, falling back to path literals.");
+#endif
+		return;
+	}
+
+	int32 NumEntries = 0;
+	Reader << NumEntries;
+	if (NumEntries < 0 || NumEntries > Bytes.Num())
+	{
+		return;
+	}
+
+	Entries.SetNum(NumEntries);
+	for (FSoundManifestEntry& Entry : Entries)
+	{
+		SerializeManifestEntry(Reader, Entry);
+	}
+
+	bLoaded = !Reader.IsError();
+	if (!bLoaded)
+	{
+		Entries.Reset();
+	}
+}
+
+const FSoundManifestEntry* FSoundManifest::Find(uint64 Id) const
+{
+	const int32 Index = Algo::LowerBoundBy(Entries, Id, &FSoundManifestEntry::Id);
+	return Entries.IsValidIndex(Index) && Entries[Index].Id == Id ? &Entries[Index] : nullptr;
+}
+
+void FSoundManifest::Write(TArray<FSoundManifestEntry>& InEntries, TArray<uint8>& OutBytes)
+{
+	InEntries.Sort([](const FSoundManifestEntry& A, const FSoundManifestEntry& B) { return A.Id < B.Id; });
+
+	FMemoryWriter Writer(OutBytes);
+	uint32 FileMagic = Magic;
+	uint32 FileVersion = Version;
+	Writer << FileMagic;
+	Writer << FileVersion;
+
+	int32 NumEntries = InEntries.Num();
+	Writer << NumEntries;
+	for (FSoundManifestEntry& Entry : InEntries)
+	{
+		SerializeManifestEntry(Writer, Entry);
+	}
+}
+
+USoundManifestCommandlet::USoundManifestCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 USoundManifestCommandlet::Main(const FString& Params)
+{
+	// Every compile-time sound path, tagged with the category it plays in.
+	TArray<TPair<const TCHAR*, EAudioCategory>> Sources;
+	for (const FUISoundInfo& Info : GUISoundTable)
+	{
+		if (Info.Path != nullptr)
+		{
+			Sources.Emplace(Info.Path, EAudioCategory::UI);
+		}
+	}
+	Sources.Emplace(FEnvironmentAudioData::WindSoundPath, EAudioCategory::Environment);
+	Sources.Emplace(FEnvironmentAudioData::RainSoundPath, EAudioCategory::Environment);
+	Sources.Emplace(FEnvironmentAudioData::ThunderSoundPath, EAudioCategory::Environment);
+	Sources.Emplace(FEnvironmentAudioData::ForestAmbientSoundPath, EAudioCategory::Environment);
+	Sources.Emplace(FUtilityAudioData::RifleFirePath, EAudioCategory::Utility);
+	Sources.Emplace(FUtilityAudioData::RifleReloadStartPath, EAudioCategory::Utility);
+	Sources.Emplace(FUtilityAudioData::RifleReloadEndPath, EAudioCategory::Utility);
+	Sources.Emplace(FUtilityAudioData::RifleAutoFireLoopPath, EAudioCategory::Utility);
+	Sources.Emplace(FUtilityAudioData::RifleAutoFireTailPath, EAudioCategory::Utility);
+
+	TArray<FSoundManifestEntry> Entries;
+	TMap<uint64, const TCHAR*> SeenIds;
+	int32 NumErrors = 0;
+
+	for (const TPair<const TCHAR*, EAudioCategory>& Source : Sources)
+	{
+		const uint64 Id = MakeSoundId(Source.Key);
+		if (const TCHAR* const* Existing = SeenIds.Find(Id))
+		{
+			if (FCString::Strcmp(*Existing, Source.Key) != 0)
+			{
+				UE_LOG(LogTemp, Error, TEXT("[SoundManifest] ID collision between %s and %s."), *Existing, Source.Key);
+				++NumErrors;
+			}
+			continue;
+		}
+		SeenIds.Add(Id, Source.Key);
+
+		const FSoftObjectPath Path(Source.Key);
+		USoundBase* Sound = Cast<USoundBase>(Path.TryLoad());
+		if (Sound == nullptr)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[SoundManifest] %s does not resolve to a sound asset."), Source.Key);
+			++NumErrors;
+			continue;
+		}
+
+		FSoundManifestEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Id = Id;
+		Entry.Path = FSoftObjectPath(Sound);
+		Entry.Category = Source.Value;
+
+		if (const USoundWave* Wave = Cast<USoundWave>(Sound))
+		{
+			Entry.Duration = Wave->Duration;
+			Entry.NumChannels = static_cast<uint8>(Wave->NumChannels);
+		}
+		else
+		{
+			Entry.Duration = Sound->GetDuration();
+		}
+	}
+
+	// A broken path fails the build rather than the first play.
+	if (NumErrors > 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[SoundManifest] %d error(s); manifest not written."), NumErrors);
+		return 1;
+	}
+
+	TArray<uint8> Bytes;
+	FSoundManifest::Write(Entries, Bytes);
+	if (!FFileHelper::SaveArrayToFile(Bytes, *FSoundManifest::GetManifestPath()))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[SoundManifest] Could not write %s."), *FSoundManifest::GetManifestPath());
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[SoundManifest] Wrote %d sounds to %s."), Entries.Num(), *FSoundManifest::GetManifestPath());
+	return 0;
+}
+
+#pragma endregion
+
+#pragma region UI
+
+#pragma region Constructor
+
+UUIAudioManager::UUIAudioManager(const FObjectInitializer& ObjectInitializer)
+: Super(ObjectInitializer)
+{
+
+}
+
+void UUIAudioManager::OnInitializeAudio()
+{
+	// Every manager after the first finds the bank already loading or loaded.
+	GetUIAudioBank().LoadUIAudioAssets();
+}
+
+void UUIAudioManager::BeginDestroy()
+{
+	// The last owner to let go frees the bank, which cancels any load still in flight.
+	UIAudioBank.Reset();
+
+	Super::BeginDestroy();
+}
+
+FUIAudioData& UUIAudioManager::GetUIAudioBank()
+{
+	if (!UIAudioBank.IsValid())
+	{
+		UIAudioBank = FUIAudioData::AcquireShared();
+	}
+	return *UIAudioBank;
+}
+
+const FUIAudioData& UUIAudioManager::GetUIAudioData() const
+{
+	// The CDO never acquires the bank; give it an empty, never-loaded view.
+	static const FUIAudioData EmptyBank;
+	return UIAudioBank.IsValid() ? *UIAudioBank : EmptyBank;
+}
+
+#pragma endregion
+
+#pragma region PlayUIAudio
+
+void UUIAudioManager::PlayUISound(UWorld* InWorldContext, EUISound Sound)
+{
+	EnsureAudioInitialized();
+
+	// Queue or skip the request while the UI sounds are still streaming in.
+	FUIAudioData& UIAudioData = GetUIAudioBank();
+	if (UIAudioData.DeferWhileLoading(InWorldContext, Sound))
+	{
+		return;
+	}
+
+	USoundBase* SoundAsset = UIAudioData.GetSound(Sound);
+	if (InWorldContext == nullptr || SoundAsset == nullptr)
+	{
+#if DEV_DEBUG_MODE
+		if (InWorldContext == nullptr)
+		{
+			LOG_ERROR("World context is null. Cannot play UI sound.");
+		}
+		if (SoundAsset == nullptr)
+		{
+			LOG_INVALID("UI sound is not assigned in UIAudioData.");
+		}
+#else
+		LOG_FATAL_USER();
+#endif
+		return;
+	}
+
+	PlaySound(InWorldContext, SoundAsset, EAudioCategory::UI, 1.f, GetUISoundInfo(Sound).Priority);
+}
+
+void UUIAudioManager::PlayHoveredSound(UWorld* InWorldContext)          { PlayUISound(InWorldContext, EUISound::Hovered); }
+void UUIAudioManager::PlayPressedSound(UWorld* InWorldContext)          { PlayUISound(InWorldContext, EUISound::Pressed); }
+void UUIAudioManager::PlaySelectSound(UWorld* InWorldContext)           { PlayUISound(InWorldContext, EUISound::Select); }
+void UUIAudioManager::PlayExitSound(UWorld* InWorldContext)             { PlayUISound(InWorldContext, EUISound::Exit); }
+void UUIAudioManager::PlaySliderIncreaseSound(UWorld* InWorldContext)   { PlayUISound(InWorldContext, EUISound::SliderIncrease); }
+void UUIAudioManager::PlaySliderDecreaseSound(UWorld* InWorldContext)   { PlayUISound(InWorldContext, EUISound::SliderDecrease); }
+void UUIAudioManager::PlayErrorSound(UWorld* InWorldContext)            { PlayUISound(InWorldContext, EUISound::Error); }
+void UUIAudioManager::PlayAcceptSound(UWorld* InWorldContext)           { PlayUISound(InWorldContext, EUISound::Accept); }
+
+#pragma endregion
+
+#pragma endregion
+
+#pragma region Utility
+
+#pragma region Constructor
+
+UUtilityAudioManager::UUtilityAudioManager(const FObjectInitializer& ObjectInitializer)
+: Super(ObjectInitializer)
+{
+}
+
+void UUtilityAudioManager::BeginDestroy()
+{
+	RifleFirePool.Reset();
+
+	for (FRifleAutoFireVoice& Voice : AutoFireVoices)
+	{
+		if (Voice.LoopVoice)
+		{
+			Voice.LoopVoice->Stop();
+			Voice.LoopVoice = nullptr;
+		}
+	}
+	AutoFireVoices.Reset();
+	FreeAutoFireSlots.Reset();
+
+	ReleaseFireClock();
+
+	Super::BeginDestroy();
+}
+
+#pragma endregion
+
+#pragma region Data
+
+const FUtilityAudioData& UUtilityAudioManager::GetUtilityAudioData() const
+{
+	return UtilityAudio::GetUtilityAudioData();
+}
+
+void UUtilityAudioManager::OnInitializeAudio()
+{
+	UtilityAudio::GetUtilityAudioData();
+}
+
+#pragma endregion
+
+#pragma region Pool
+
+void UUtilityAudioManager::SetRifleFirePoolCapacity(int32 InCapacity)
+{
+	RifleFirePool.SetCapacity(InCapacity);
+}
+
+void UUtilityAudioManager::PrewarmRifleFirePool(UWorld* InWorldContext)
+{
+	EnsureAudioInitialized();
+	RifleFirePool.Prewarm(InWorldContext, GetUtilityAudioData().GetRifleFire());
+}
+
+#pragma endregion
+
+#pragma region PlayUtilityAudio
+
+#pragma region Weapon
+
+#pragma region Rifle 
+
+void UUtilityAudioManager::PlayRifleFire(UWorld* InWorldContext)
+{
+	EnsureAudioInitialized();
+
+	// Check if the world context is valid before proceeding.
+	if (InWorldContext == nullptr)
+	{
+		#if DEV_DEBUG_MODE
+			LOG_ERROR("World context is null. Cannot play rifle fire sound.");
+		#endif
+		return;
+	}
+
+	// The utility bank streams in after InitializeAudio; a shot fired before it lands is dropped.
+	USoundBase* FireSound = GetUtilityAudioData().GetRifleFire();
+	if (FireSound == nullptr)
+	{
+		#if DEV_DEBUG_MODE
+			LOG_ERROR("Rifle fire sound is not assigned in UtilityAudioData or is still streaming in.");
+		#endif
+		return;
+	}
+
+	// Replay a pooled voice instead of spawning a new active sound per shot.
+	RifleFirePool.Play(InWorldContext, FireSound);
+}
+
+void UUtilityAudioManager::PlayRifleReloadStart(UWorld* InWorldContext)
+{
+	EnsureAudioInitialized();
+
+	// Check if the world context is valid before proceeding.
+	if (InWorldContext == nullptr)
+	{
+		#if DEV_DEBUG_MODE
+				LOG_ERROR("World context is null. Cannot play rifle reload start sound.");
+		#endif
+		return;
+	}
+
+	// Dropped rather than fatal: the sound may still be streaming in.
+	USoundBase* ReloadStartSound = GetUtilityAudioData().GetRifleReloadStart();
+	if (ReloadStartSound == nullptr)
+	{
+		#if DEV_DEBUG_MODE
+				LOG_ERROR("Rifle reload start sound is not assigned in UtilityAudioData or is still streaming in.");
+		#endif
+		return;
+	}
+
+	#if DEV_DEBUG_MODE
+		LOG_INFO("Rifle reload start sound has been played successfully.");
+	#endif
+
+	// Play the assigned rifle reload start sound using the provided world context.
+	PlaySound(InWorldContext, ReloadStartSound, EAudioCategory::Utility);
+}
+
+void UUtilityAudioManager::PlayRifleReloadStop(UWorld* InWorldContext)
+{
+	EnsureAudioInitialized();
+
+	// Check if the world context is valid before proceeding.
+	if (InWorldContext == nullptr)
+	{
+		#if DEV_DEBUG_MODE
+				LOG_ERROR("World context is null. Cannot play rifle reload stop sound.");
+		#endif
+		return;
+	}
+
+	// Dropped rather than fatal: the sound may still be streaming in.
+	USoundBase* ReloadEndSound = GetUtilityAudioData().GetRifleReloadEnd();
+	if (ReloadEndSound == nullptr)
+	{
+		#if DEV_DEBUG_MODE
+			LOG_ERROR("Rifle reload stop sound is not assigned in UtilityAudioData or is still streaming in.");
+		#endif
+		return;
+	}
+
+	#if DEV_DEBUG_MODE
+		LOG_INFO("Rifle reload stop sound has been played successfully.");
+	#endif
+
+	// Play the assigned rifle reload stop sound using the provided world context.
+	PlaySound(InWorldContext, ReloadEndSound, EAudioCategory::Utility);
+}
+
+#pragma endregion
+
+#pragma region AutoFire
+
+int32 UUtilityAudioManager::StartRifleAutoFire(UWorld* InWorldContext, float RoundsPerMinute, bool bAutomatic, int32 Handle)
+{
+	EnsureAudioInitialized();
+
+	if (InWorldContext == nullptr)
+	{
+#if DEV_DEBUG_MODE
+		LOG_ERROR("World context is null. Cannot start rifle auto fire.");
+#endif
+		return Handle;
+	}
+
+	// Semi-auto rounds are far enough apart for one-shots; so is every weapon without a loop sample.
+	USoundBase* LoopSound = GetUtilityAudioData().GetRifleAutoFireLoop();
+	if (!bAutomatic || LoopSound == nullptr)
+	{
+		PlayRifleFire(InWorldContext);
+		return Handle;
+	}
+
+	FRifleAutoFireVoice* Voice = FindAutoFireVoice(Handle);
+	if (Voice == nullptr)
+	{
+		Handle = FreeAutoFireSlots.Num() > 0 ? FreeAutoFireSlots.Pop() : AutoFireVoices.AddDefaulted();
+		Voice = &AutoFireVoices[Handle];
+		Voice->bInUse = true;
+	}
+
+	// A voice from another world (e.g. after a map change) is dropped and recreated.
+	if (Voice->LoopVoice && Voice->LoopVoice->GetWorld() != InWorldContext)
+	{
+		Voice->LoopVoice->Stop();
+		Voice->LoopVoice = nullptr;
+	}
+	if (Voice->LoopVoice == nullptr)
+	{
+		// bAutoDestroy is false so the voice is reused across bursts.
+		Voice->LoopVoice = UGameplayStatics::CreateSound2D(InWorldContext, LoopSound, 1.f, 1.f, 0.f, nullptr, false, false);
+		if (Voice->LoopVoice == nullptr)
+		{
+#if DEV_DEBUG_MODE
+			LOG_ERROR("Failed to create the rifle auto fire voice. Is audio disabled?");
+#endif
+			return Handle;
+		}
+	}
+
+	Voice->RoundsPerMinute = RoundsPerMinute;
+	ApplyAutoFireRate(*Voice);
+	if (!Voice->bFiring || !Voice->LoopVoice->IsPlaying())
+	{
+		Voice->LoopVoice->SetSound(LoopSound);
+		Voice->LoopVoice->Play();
+		RecordSoundRequest(LoopSound, ESoundRequestOutcome::Started, GetRequestCycles());
+	}
+	Voice->bFiring = true;
+	return Handle;
+}
+
+void UUtilityAudioManager::SetRifleAutoFireRate(int32 Handle, float RoundsPerMinute)
+{
+	if (FRifleAutoFireVoice* Voice = FindAutoFireVoice(Handle))
+	{
+		Voice->RoundsPerMinute = RoundsPerMinute;
+		ApplyAutoFireRate(*Voice);
+	}
+}
+
+void UUtilityAudioManager::StopRifleAutoFire(UWorld* InWorldContext, int32 Handle)
+{
+	FRifleAutoFireVoice* Voice = FindAutoFireVoice(Handle);
+	if (Voice == nullptr || !Voice->bFiring)
+	{
+		return;
+	}
+	Voice->bFiring = false;
+
+	if (Voice->LoopVoice)
+	{
+		Voice->LoopVoice->FadeOut(AutoFireStopFadeSeconds, 0.f);
+	}
+
+	// The tail is the only other voice a burst ever uses.
+	if (USoundBase* TailSound = GetUtilityAudioData().GetRifleAutoFireTail())
+	{
+		PlaySound(InWorldContext, TailSound, EAudioCategory::Utility);
+	}
+}
+
+void UUtilityAudioManager::ReleaseRifleAutoFire(int32 Handle)
+{
+	if (FRifleAutoFireVoice* Voice = FindAutoFireVoice(Handle))
+	{
+		if (Voice->LoopVoice)
+		{
+			Voice->LoopVoice->Stop();
+		}
+		*Voice = FRifleAutoFireVoice();
+		FreeAutoFireSlots.Add(Handle);
+	}
+}
+
+FRifleAutoFireVoice* UUtilityAudioManager::FindAutoFireVoice(int32 Handle)
+{
+	return AutoFireVoices.IsValidIndex(Handle) && AutoFireVoices[Handle].bInUse ? &AutoFireVoices[Handle] : nullptr;
+}
+
+void UUtilityAudioManager::ApplyAutoFireRate(FRifleAutoFireVoice& Voice) const
+{
+	if (Voice.LoopVoice == nullptr)
+	{
+		return;
+	}
+
+	// Pitch shortens the loop's period in proportion to the rate. Sounds that expose a FireRate
+	// parameter (MetaSounds, cue parameters) can retime themselves without the pitch change.
+	const float Pitch = FMath::Clamp(Voice.RoundsPerMinute / FMath::Max(AutoFireReferenceRate, 1.f), AutoFirePitchRange.X, AutoFirePitchRange.Y);
+	Voice.LoopVoice->SetPitchMultiplier(Pitch);
+	Voice.LoopVoice->SetFloatParameter(TEXT("FireRate"), Voice.RoundsPerMinute);
+}
+
+#pragma endregion
+
+#pragma region Scheduling
+
+namespace
+{
+	/** FQuartzClockSettings defaults to 4/4 */
+	constexpr int32 FireClockBeatsPerBar = 4;
+}
+
+void UUtilityAudioManager::StartRifleFireCadence(UWorld* InWorldContext, float RoundsPerMinute, int32 NumShots)
+{
+	EnsureAudioInitialized();
+
+	if (InWorldContext == nullptr)
+	{
+#if DEV_DEBUG_MODE
+		LOG_ERROR("World context is null. Cannot start rifle fire cadence.");
+#endif
+		return;
+	}
+
+	// The rifle sounds stream in after InitializeAudio. The clock starts regardless: QueueFireBeats
+	// skips rounds until the fire sound is resident, so an early burst starts a beat or two late.
+	USoundBase* FireSound = GetUtilityAudioData().GetRifleFire();
+
+	UQuartzClockHandle* Clock = GetFireClock(InWorldContext);
+	if (Clock == nullptr)
+	{
+		// No audio mixer (e.g. -nosound): nothing to schedule against.
+		if (FireSound != nullptr)
+		{
+			PlayRifleFire(InWorldContext);
+		}
+		return;
+	}
+
+	Clock->SetBeatsPerMinute(InWorldContext, FQuartzQuantizationBoundary(), FOnQuartzCommandEventBP(), Clock, FMath::Max(RoundsPerMinute, 1.f));
+
+	// Stopping resets the transport, so round N of this burst is transport beat N.
+	Clock->StopClock(InWorldContext, true, Clock);
+	bFireCadenceActive = true;
+	NextFireBeat = 0;
+	FireShotsRemaining = NumShots > 0 ? NumShots : INDEX_NONE;
+
+	QueueFireBeats(InWorldContext, INDEX_NONE);
+	Clock->StartClock(InWorldContext, Clock);
+}
+
+void UUtilityAudioManager::SetRifleFireCadenceRate(UWorld* InWorldContext, float RoundsPerMinute)
+{
+	UQuartzClockHandle* Clock = FireClock;
+	if (Clock != nullptr && InWorldContext != nullptr && FireClockWorld.Get() == InWorldContext)
+	{
+		Clock->SetBeatsPerMinute(InWorldContext, FQuartzQuantizationBoundary(), FOnQuartzCommandEventBP(), Clock, FMath::Max(RoundsPerMinute, 1.f));
+	}
+}
+
+void UUtilityAudioManager::StopRifleFireCadence(UWorld* InWorldContext)
+{
+	bFireCadenceActive = false;
+	FireShotsRemaining = INDEX_NONE;
+
+	UQuartzClockHandle* Clock = FireClock;
+	if (Clock != nullptr && InWorldContext != nullptr && FireClockWorld.Get() == InWorldContext)
+	{
+		Clock->StopClock(InWorldContext, true, Clock);
+	}
+}
+
+UQuartzClockHandle* UUtilityAudioManager::GetFireClock(UWorld* InWorld)
+{
+	if (FireClock != nullptr && FireClockWorld.Get() == InWorld)
+	{
+		return FireClock;
+	}
+
+	ReleaseFireClock();
+
+	UQuartzSubsystem* Quartz = UQuartzSubsystem::Get(InWorld);
+	if (Quartz == nullptr)
+	{
+		return nullptr;
+	}
+
+	// One clock per manager so two weapons never share a transport.
+	const FName ClockName(*FString::Printf(TEXT("RifleFire_%u"), GetUniqueID()));
+	FQuartzClockSettings Settings;
+	UQuartzClockHandle* Clock = Quartz->CreateNewClock(InWorld, ClockName, Settings, true);
+	if (Clock == nullptr)
+	{
+		return nullptr;
+	}
+
+	FOnQuartzMetronomeEventBP OnBeat;
+	OnBeat.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UUtilityAudioManager, HandleFireClockBeat));
+	Clock->SubscribeToQuantizationEvent(InWorld, EQuartzCommandQuantization::Beat, OnBeat, Clock);
+
+	FireClock = Clock;
+	FireClockWorld = InWorld;
+	return Clock;
+}
+
+void UUtilityAudioManager::QueueFireBeats(UWorld* InWorld, int32 CurrentBeat)
+{
+	if (FireClock == nullptr)
+	{
+		return;
+	}
+
+	// Still streaming in: the next beat tries again. Rounds only count against a burst once they
+	// are queued, so a burst still fires all of its rounds, just later.
+	USoundBase* FireSound = GetUtilityAudioData().GetRifleFire();
+	if (FireSound == nullptr)
+	{
+		return;
+	}
+
+	// A boundary of Beat x N relative to the transport lands on beat N only while beat N is still
+	// ahead; anything closer than one beat may pass before the command reaches the audio thread.
+	// Those rounds are skipped so a hitch never bunches shots together.
+	if (CurrentBeat >= 0)
+	{
+		NextFireBeat = FMath::Max(NextFireBeat, CurrentBeat + 2);
+	}
+
+	const int32 LastBeat = CurrentBeat + FMath::Max(FireLookaheadBeats, 2);
+	while (NextFireBeat <= LastBeat && FireShotsRemaining != 0)
+	{
+		// Round 0 is queued on the stopped clock and fires as the clock starts.
+		const bool bOnClockStart = NextFireBeat == 0;
+		const FQuartzQuantizationBoundary Boundary(EQuartzCommandQuantization::Beat, bOnClockStart ? 1.f : static_cast<float>(NextFireBeat),
+			EQuarztQuantizationReference::TransportRelative, bOnClockStart);
+		RifleFirePool.PlayQuantized(InWorld, FireSound, FireClock, Boundary);
+
+		++NextFireBeat;
+		if (FireShotsRemaining > 0)
+		{
+			--FireShotsRemaining;
+		}
+	}
+}
+
+void UUtilityAudioManager::HandleFireClockBeat(FName ClockName, EQuartzCommandQuantization QuantizationType, int32 NumBars, int32 Beat, float BeatFraction)
+{
+	UWorld* World = FireClockWorld.Get();
+	if (!bFireCadenceActive || World == nullptr)
+	{
+		return;
+	}
+
+	// Bars and beats are reported 1-based.
+	const int32 CurrentBeat = (NumBars - 1) * FireClockBeatsPerBar + (Beat - 1);
+
+	// A finished burst stops its clock once the last round has played.
+	if (FireShotsRemaining == 0 && CurrentBeat >= NextFireBeat - 1)
+	{
+		bFireCadenceActive = false;
+		UQuartzClockHandle* Clock = FireClock;
+		Clock->StopClock(World, false, Clock);
+		return;
+	}
+
+	QueueFireBeats(World, CurrentBeat);
+}
+
+void UUtilityAudioManager::ReleaseFireClock()
+{
+	UQuartzClockHandle* Clock = FireClock;
+	UWorld* World = FireClockWorld.Get();
+	if (Clock != nullptr && World != nullptr)
+	{
+		Clock->StopClock(World, true, Clock);
+		if (UQuartzSubsystem* Quartz = UQuartzSubsystem::Get(World))
+		{
+			Quartz->DeleteClockByHandle(World, Clock);
+		}
+	}
+
+	FireClock = nullptr;
+	FireClockWorld.Reset();
+	bFireCadenceActive = false;
+}
+
+
+
+#pragma endregion
+
+#pragma endregion
+
+#pragma endregion
+
+#pragma endregion
+
+#pragma region UINamespace
+
+namespace
+{
+	/** The UIAudio helpers' reference to the shared UI bank, held from first use until engine pre-exit. */
+	class FUIAudioBankOwner
+	{
+	public:
+		FUIAudioBankOwner()
+		{
+			// Multicast delegates are not thread-safe; bind from the game thread.
+			if (IsInGameThread())
+			{
+				BindPreExit();
+			}
+			else
+			{
+				AsyncTask(ENamedThreads::GameThread, [this]
+				{
+					BindPreExit();
+				});
+			}
+		}
+
+		TSharedPtr<FUIAudioData> Get()
+		{
+			if (bReleased)
+			{
+				return FUIAudioData::FindShared();
+			}
+
+			// Only the game thread plays UI sounds, so the lazy acquire needs no lock.
+			check(IsInGameThread());
+			if (!Bank.IsValid())
+			{
+				Bank = FUIAudioData::AcquireShared();
+			}
+			return Bank;
+		}
+
+	private:
+		void BindPreExit()
+		{
+			FCoreDelegates::OnPreExit.AddRaw(this, &FUIAudioBankOwner::Release);
+		}
+
+		/** Frees the bank, and any load still in flight, while the engine is still up. */
+		void Release()
+		{
+			bReleased = true;
+			Bank.Reset();
+		}
+
+		TSharedPtr<FUIAudioData> Bank;
+
+		bool bReleased = false;
+	};
+}
+
+TSharedPtr<FUIAudioData> UIAudio::GetUIAudioData()
+{
+	static FUIAudioBankOwner Owner;
+	return Owner.Get();
+}
+
+#pragma endregion
+
+#pragma region UtilityNamespace
+
+namespace
+{
+	/** Keeps the namespace-level rifle voices referenced while no UObject owns them. */
+	class FRifleFireVoicePoolReferencer : public FGCObject
+	{
+	public:
+		FAudioVoicePool Pool;
+
+		FRifleFireVoicePoolReferencer()
+		{
+			// The voices are outered to their world; release them with it so this referencer never keeps it alive.
+			FWorldDelegates::OnWorldCleanup.AddRaw(this, &FRifleFireVoicePoolReferencer::HandleWorldCleanup);
+		}
+
+		void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+		{
+			Pool.ReleaseWorld(World);
+		}
+
+		virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+		{
+			Pool.AddReferencedObjects(Collector);
+		}
+
+		virtual FString GetReferencerName() const override
+		{
+			return TEXT("UtilityAudio::RifleFireVoicePool");
+		}
+	};
+}
+
+const FUtilityAudioData& UtilityAudio::GetUtilityAudioData()
+{
+	// Function-local static: built once, on first use, and safe against concurrent first calls.
+	// Construction only records sound IDs; the loads are requested from the game thread.
+	static const FUtilityAudioData UtilityAudioData;
+	static const bool bLoadRequested = []
+	{
+		if (IsInGameThread())
+		{
+			UtilityAudioData.LoadUtilityAudioAssets();
+		}
+		else
+		{
+			AsyncTask(ENamedThreads::GameThread, []
+			{
+				UtilityAudioData.LoadUtilityAudioAssets();
+			});
+		}
+		return true;
+	}();
+	(void)bLoadRequested;
+	return UtilityAudioData;
+}
+
+FAudioVoicePool& UtilityAudio::GetRifleFireVoicePool()
+{
+	// Constructed on first use, after the garbage collector is up.
+	static FRifleFireVoicePoolReferencer Referencer;
+	return Referencer.Pool;
+}
+
+#pragma endregion
+
+#pragma region Character
+
+UCharacterAudioManager::UCharacterAudioManager(const FObjectInitializer& ObjectInitializer)
+: Super(ObjectInitializer)
+{
+
+}
+
+void UCharacterAudioManager::SetFootstepSound(TEnumAsByte<EPhysicalSurface> Surface, USoundBase* Sound)
+{
+	CharacterAudioData.SetFootstepSound(Surface, Sound);
+}
+
+void UCharacterAudioManager::SetJumpSound(TEnumAsByte<EPhysicalSurface> Surface, USoundBase* Sound)
+{
+	CharacterAudioData.SetJumpSound(Surface, Sound);
+}
+
+void UCharacterAudioManager::SetLandSound(TEnumAsByte<EPhysicalSurface> Surface, USoundBase* Sound)
+{
+	CharacterAudioData.SetLandSound(Surface, Sound);
+}
+
+void UCharacterAudioManager::PlayFootstep(UWorld* InWorldContext, TEnumAsByte<EPhysicalSurface> Surface, FVector Location, float VolumeMultiplier)
+{
+	// Footsteps are the hottest character path: no logging when the surface simply has no sound.
+	if (USoundBase* Sound = CharacterAudioData.GetFootstepSound(Surface))
+	{
+		PlaySoundAtLocation(InWorldContext, Sound, Location, EAudioCategory::Character, VolumeMultiplier);
+	}
+}
+
+void UCharacterAudioManager::PlayJump(UWorld* InWorldContext, TEnumAsByte<EPhysicalSurface> Surface, FVector Location, float VolumeMultiplier)
+{
+	if (USoundBase* Sound = CharacterAudioData.GetJumpSound(Surface))
+	{
+		PlaySoundAtLocation(InWorldContext, Sound, Location, EAudioCategory::Character, VolumeMultiplier);
+	}
+}
+
+void UCharacterAudioManager::PlayLand(UWorld* InWorldContext, TEnumAsByte<EPhysicalSurface> Surface, FVector Location, float VolumeMultiplier)
+{
+	if (USoundBase* Sound = CharacterAudioData.GetLandSound(Surface))
+	{
+		PlaySoundAtLocation(InWorldContext, Sound, Location, EAudioCategory::Character, VolumeMultiplier);
+	}
+}
+
+#pragma endregion
+
+#pragma region Environment
+
+
+UEnvironmentAudioManager::UEnvironmentAudioManager(const FObjectInitializer& ObjectInitializer)
+: Super(ObjectInitializer)
+{
+
+}
+
+void UEnvironmentAudioManager::OnInitializeAudio()
+{
+	EnvironmentAudioData.LoadEnvironmentAudioAssets();
+}
+
+void UEnvironmentAudioManager::BeginDestroy()
+{
+	if (VirtualVoiceTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(VirtualVoiceTickHandle);
+		VirtualVoiceTickHandle.Reset();
+	}
+
+	for (FEnvironmentVirtualVoice& Voice : Emitters)
+	{
+		if (Voice.RealVoice)
+		{
+			Voice.RealVoice->Stop();
+			Voice.RealVoice = nullptr;
+		}
+	}
+	Emitters.Reset();
+	FreeEmitterSlots.Reset();
+
+	Super::BeginDestroy();
+}
+
+#pragma region VirtualVoice
+
+namespace
+{
+	/** Loop length used to keep virtual playback positions; zero if the sound cannot tell. */
+	float GetLoopDuration(const USoundBase* Sound)
+	{
+		// Looping waves report an indefinite duration, the asset length is what we need.
+		if (const USoundWave* Wave = Cast<USoundWave>(Sound))
+		{
+			return Wave->Duration;
+		}
+
+		const float Duration = Sound->GetDuration();
+		return Duration < INDEFINITELY_LOOPING_DURATION ? Duration : 0.f;
+	}
+}
+
+int32 UEnvironmentAudioManager::AddLoopingEmitter(UObject* WorldContextObject, USoundBase* Sound, FVector Location, float VolumeMultiplier, float PitchMultiplier)
+{
+	EnsureAudioInitialized();
+
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	if (!World || !Sound)
+	{
+#if DEV_DEBUG_MODE
+		LOG_ERROR("AddLoopingEmitter: World or Sound is NULL!");
+#endif
+		return INDEX_NONE;
+	}
+
+	// Emitters are tracked against a single world; a world change drops the old ones.
+	if (EmitterWorld.Get() != World)
+	{
+		for (FEnvironmentVirtualVoice& Voice : Emitters)
+		{
+			if (Voice.RealVoice)
+			{
+				Voice.RealVoice->Stop();
+			}
+		}
+		Emitters.Reset();
+		FreeEmitterSlots.Reset();
+		EmitterWorld = World;
+	}
+
+	const int32 Handle = FreeEmitterSlots.Num() > 0 ? FreeEmitterSlots.Pop() : Emitters.AddDefaulted();
+
+	FEnvironmentVirtualVoice& Voice = Emitters[Handle];
+	Voice = FEnvironmentVirtualVoice();
+	Voice.Sound = Sound;
+	Voice.Location = Location;
+	Voice.VolumeMultiplier = VolumeMultiplier;
+	Voice.PitchMultiplier = FMath::Max(0.01f, PitchMultiplier);
+	Voice.LoopDuration = GetLoopDuration(Sound);
+	Voice.BaseTime = World->GetAudioTimeSeconds();
+	Voice.bInUse = true;
+
+	if (!VirtualVoiceTickHandle.IsValid())
+	{
+		VirtualVoiceTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UEnvironmentAudioManager::TickVirtualVoices),
+			VirtualVoiceUpdateInterval);
+	}
+
+	return Handle;
+}
+
+void UEnvironmentAudioManager::RemoveLoopingEmitter(int32 Handle)
+{
+	if (FEnvironmentVirtualVoice* Voice = FindEmitter(Handle))
+	{
+		if (Voice->RealVoice)
+		{
+			Voice->RealVoice->Stop();
+		}
+		*Voice = FEnvironmentVirtualVoice();
+		FreeEmitterSlots.Add(Handle);
+	}
+}
+
+void UEnvironmentAudioManager::SetEmitterLocation(int32 Handle, FVector Location)
+{
+	if (FEnvironmentVirtualVoice* Voice = FindEmitter(Handle))
+	{
+		Voice->Location = Location;
+		if (Voice->RealVoice)
+		{
+			Voice->RealVoice->SetWorldLocation(Location);
+		}
+	}
+}
+
+void UEnvironmentAudioManager::SetEmitterVolume(int32 Handle, float VolumeMultiplier)
+{
+	if (FEnvironmentVirtualVoice* Voice = FindEmitter(Handle))
+	{
+		Voice->VolumeMultiplier = VolumeMultiplier;
+		if (Voice->RealVoice)
+		{
+			Voice->RealVoice->SetVolumeMultiplier(VolumeMultiplier);
+		}
+	}
+}
+
+void UEnvironmentAudioManager::SetEmitterPitch(int32 Handle, float PitchMultiplier)
+{
+	FEnvironmentVirtualVoice* Voice = FindEmitter(Handle);
+	UWorld* World = EmitterWorld.Get();
+	if (Voice && World)
+	{
+		// Keep the position continuous: elapsed time so far ran at the old pitch.
+		Voice->Rebase(World->GetAudioTimeSeconds());
+		Voice->PitchMultiplier = FMath::Max(0.01f, PitchMultiplier);
+		if (Voice->RealVoice)
+		{
+			Voice->RealVoice->SetPitchMultiplier(Voice->PitchMultiplier);
+		}
+	}
+}
+
+void UEnvironmentAudioManager::SetMaxRealVoices(int32 InMaxRealVoices)
+{
+	MaxRealVoices = FMath::Max(0, InMaxRealVoices);
+}
+
+void UEnvironmentAudioManager::SetAudibilityThreshold(float InMinVolume)
+{
+	AudibilityThreshold = FMath::Max(0.f, InMinVolume);
+}
+
+int32 UEnvironmentAudioManager::GetRealVoiceCount() const
+{
+	int32 Count = 0;
+	for (const FEnvironmentVirtualVoice& Voice : Emitters)
+	{
+		Count += (Voice.bInUse && Voice.RealVoice) ? 1 : 0;
+	}
+	return Count;
+}
+
+int32 UEnvironmentAudioManager::GetVirtualVoiceCount() const
+{
+	return Emitters.Num() - FreeEmitterSlots.Num() - GetRealVoiceCount();
+}
+
+FEnvironmentVirtualVoice* UEnvironmentAudioManager::FindEmitter(int32 Handle)
+{
+	return Emitters.IsValidIndex(Handle) && Emitters[Handle].bInUse ? &Emitters[Handle] : nullptr;
+}
+
+bool UEnvironmentAudioManager::TickVirtualVoices(float DeltaTime)
+{
+	UWorld* World = EmitterWorld.Get();
+	if (World == nullptr)
+	{
+		return true;
+	}
+
+	FListenerGrid& Grid = GetListenerGrid();
+	Grid.Refresh(World);
+
+	const double Now = World->GetAudioTimeSeconds();
+
+	// Audible emitters, closest first. Real voices get a slightly larger radius so an
+	// emitter on the boundary does not flip every update.
+	TArray<TPair<float, int32>, TInlineAllocator<64>> Audible;
+	for (int32 Index = 0; Index < Emitters.Num(); ++Index)
+	{
+		FEnvironmentVirtualVoice& Voice = Emitters[Index];
+		if (!Voice.bInUse || !Voice.Sound)
+		{
+			continue;
+		}
+
+		// Stopped from outside (e.g. a concurrency limit); carry on virtually from here.
+		if (Voice.RealVoice && !Voice.RealVoice->IsPlaying())
+		{
+			DemoteVoice(Voice, Now);
+		}
+
+		if (Voice.VolumeMultiplier < AudibilityThreshold)
+		{
+			continue;
+		}
+
+		const float Range = Voice.Sound->GetMaxDistance() * (Voice.RealVoice ? 1.f + DemoteHysteresis : 1.f);
+		const float DistanceSq = Grid.GetNearestDistanceSquared(Voice.Location);
+		if (DistanceSq <= FMath::Square(Range))
+		{
+			Audible.Emplace(DistanceSq, Index);
+		}
+	}
+
+	Audible.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+
+	TBitArray<> ShouldBeReal(false, Emitters.Num());
+	for (int32 Rank = 0; Rank < FMath::Min(MaxRealVoices, Audible.Num()); ++Rank)
+	{
+		ShouldBeReal[Audible[Rank].Value] = true;
+	}
+
+	// Demote first so the promotions below never overshoot the real voice budget.
+	for (int32 Index = 0; Index < Emitters.Num(); ++Index)
+	{
+		if (Emitters[Index].RealVoice && !ShouldBeReal[Index])
+		{
+			DemoteVoice(Emitters[Index], Now);
+		}
+	}
+	for (int32 Index = 0; Index < Emitters.Num(); ++Index)
+	{
+		if (!Emitters[Index].RealVoice && ShouldBeReal[Index])
+		{
+			PromoteVoice(World, Emitters[Index], Now);
+		}
+	}
+
+	return true;
+}
+
+void UEnvironmentAudioManager::PromoteVoice(UWorld* World, FEnvironmentVirtualVoice& Voice, double Now)
+{
+	const uint64 RequestCycles = GetRequestCycles();
+
+	// Real voices count against the Environment limits like PlaySoundAtLocation; a rejected emitter
+	// stays virtual and is offered again on the next update.
+	if (!AdmitVoice(EAudioCategory::Environment, Voice.Sound, Voice.VolumeMultiplier, 128))
+	{
+		RecordSoundRequest(Voice.Sound, ESoundRequestOutcome::Rejected, RequestCycles);
+		return;
+	}
+
+	// Start where the loop would be had it been playing all along.
+	const float StartTime = Voice.GetPlaybackPosition(Now);
+	Voice.RealVoice = UGameplayStatics::SpawnSoundAtLocation(World, Voice.Sound, Voice.Location, FRotator::ZeroRotator,
+		Voice.VolumeMultiplier, Voice.PitchMultiplier, StartTime);
+	if (Voice.RealVoice == nullptr)
+	{
+		RecordSoundRequest(Voice.Sound, ESoundRequestOutcome::Rejected, RequestCycles);
+		return;
+	}
+
+	TrackVoice(EAudioCategory::Environment, Voice.RealVoice, Voice.Sound, Voice.VolumeMultiplier, 128);
+	RecordSoundRequest(Voice.Sound, ESoundRequestOutcome::Started, RequestCycles);
+}
+
+void UEnvironmentAudioManager::DemoteVoice(FEnvironmentVirtualVoice& Voice, double Now)
+{
+	Voice.Rebase(Now);
+	if (Voice.RealVoice)
+	{
+		// Spawned with auto destroy, so stopping releases the component.
+		Voice.RealVoice->Stop();
+		Voice.RealVoice = nullptr;
+	}
+}
+
+#pragma endregion
+
+#pragma endregion
+
+#pragma region Music
+
+UMusicManager::UMusicManager(const FObjectInitializer& ObjectInitializer)
+: Super(ObjectInitializer)
+{
+	TrackStreamer.SetOwner(this);
+
+	// Jumping straight between the extremes is allowed but uses a short, punchy crossfade;
+	// dropping from Intense goes through Ambient.
+	auto SetRule = [this](EMusicIntensityState From, EMusicIntensityState To, bool bAllowed, float CrossfadeSeconds)
+	{
+		FMusicTransitionRule& Rule = TransitionRules[static_cast<int32>(From) * static_cast<int32>(EMusicIntensityState::Count) + static_cast<int32>(To)];
+		Rule.bAllowed = bAllowed;
+		Rule.CrossfadeSeconds = CrossfadeSeconds;
+	};
+
+	SetRule(EMusicIntensityState::Calm, EMusicIntensityState::Ambient, true, 4.f);
+	SetRule(EMusicIntensityState::Calm, EMusicIntensityState::Intense, true, 1.f);
+	SetRule(EMusicIntensityState::Ambient, EMusicIntensityState::Calm, true, 6.f);
+	SetRule(EMusicIntensityState::Ambient, EMusicIntensityState::Intense, true, 1.5f);
+	SetRule(EMusicIntensityState::Intense, EMusicIntensityState::Ambient, true, 5.f);
+	SetRule(EMusicIntensityState::Intense, EMusicIntensityState::Calm, false, 0.f);
+}
+
+void UMusicManager::BeginDestroy()
+{
+	StopMusic();
+	TrackStreamer.ReleaseAll();
+
+	Super::BeginDestroy();
+}
+
+#pragma region Streaming
+
+FMusicTrackStreamer::FResidentTrack& FMusicTrackStreamer::FindOrAddTrack(EMusicGenre Genre, const FSoftObjectPath& Path)
+{
+	FGenreCache& Cache = Genres[static_cast<int32>(Genre)];
+	for (FResidentTrack& Track : Cache.Tracks)
+	{
+		if (Track.Path == Path)
+		{
+			return Track;
+		}
+	}
+
+	FResidentTrack& Track = Cache.Tracks.AddDefaulted_GetRef();
+	Track.Path = Path;
+	return Track;
+}
+
+void FMusicTrackStreamer::RequestTrack(EMusicGenre Genre, const TSoftObjectPtr<USoundWave>& Track, FOnTrackReady OnReady)
+{
+	const FSoftObjectPath Path = Track.ToSoftObjectPath();
+	if (Path.IsNull())
+	{
+		OnReady.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	FResidentTrack& Resident = FindOrAddTrack(Genre, Path);
+	Resident.LastUsedTime = FPlatformTime::Seconds();
+
+	// Already resident (typically the prefetched track): no load, no wait.
+	if (Track.Get())
+	{
+		HandleTrackLoaded(Genre, Path, false, MoveTemp(OnReady));
+		return;
+	}
+
+	if (!Resident.Handle.IsValid())
+	{
+		Resident.Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Path,
+			MakeLoadedDelegate(Genre, Path, false, OnReady),
+			FStreamableManager::AsyncLoadHighPriority);
+	}
+	else if (Resident.Handle->HasLoadCompleted())
+	{
+		// The prefetch already landed; a delegate bound now would never fire.
+		HandleTrackLoaded(Genre, Path, false, MoveTemp(OnReady));
+		return;
+	}
+	else
+	{
+		// A prefetch for this track is in flight. Its callback is replaced, which only skips priming
+		// a track that is about to play anyway.
+		Resident.Handle->BindCompleteDelegate(MakeLoadedDelegate(Genre, Path, false, OnReady));
+	}
+
+	// The handle was null or completed synchronously.
+	if (!Resident.Handle.IsValid())
+	{
+		HandleTrackLoaded(Genre, Path, false, MoveTemp(OnReady));
+	}
+}
+
+void FMusicTrackStreamer::PrefetchTrack(EMusicGenre Genre, const TSoftObjectPtr<USoundWave>& Track)
+{
+	const FSoftObjectPath Path = Track.ToSoftObjectPath();
+	if (Path.IsNull())
+	{
+		return;
+	}
+
+	FGenreCache& Cache = Genres[static_cast<int32>(Genre)];
+	Cache.Prefetched = Path;
+
+	FResidentTrack& Resident = FindOrAddTrack(Genre, Path);
+	Resident.LastUsedTime = FPlatformTime::Seconds();
+	if (Resident.Handle.IsValid())
+	{
+		return;
+	}
+
+	Resident.Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Path,
+		MakeLoadedDelegate(Genre, Path, true, FOnTrackReady()),
+		FStreamableManager::DefaultAsyncLoadPriority);
+}
+
+FStreamableDelegate FMusicTrackStreamer::MakeLoadedDelegate(EMusicGenre Genre, const FSoftObjectPath& Path, bool bPrime, FOnTrackReady OnReady)
+{
+	check(Owner.IsValid());
+
+	// The streamer lives inside Owner, so Owner being alive keeps this valid.
+	return FStreamableDelegate::CreateWeakLambda(Owner.Get(), [this, Genre, Path, bPrime, OnReady = MoveTemp(OnReady)]()
+	{
+		HandleTrackLoaded(Genre, Path, bPrime, OnReady);
+	});
+}
+
+void FMusicTrackStreamer::HandleTrackLoaded(EMusicGenre Genre, FSoftObjectPath Path, bool bPrime, FOnTrackReady OnReady)
+{
+	USoundWave* Wave = Cast<USoundWave>(Path.ResolveObject());
+	if (Wave)
+	{
+		// Stream the track in chunks instead of keeping the whole asset resident.
+		Wave->OverrideLoadingBehavior(ESoundWaveLoadingBehavior::LoadOnDemand);
+
+		if (bPrime)
+		{
+			// Pull the first chunk in now so the transition does not wait on IO.
+			UGameplayStatics::PrimeSound(Wave);
+		}
+
+		FResidentTrack& Resident = FindOrAddTrack(Genre, Path);
+		Resident.Bytes = static_cast<int64>(Wave->GetResourceSizeBytes(EResourceSizeMode::Exclusive));
+	}
+#if DEV_DEBUG_MODE
+	else
+	{
+		LOG_ERROR("FMusicTrackStreamer: failed to load a music track!");
+	}
+#endif
+
+	EnforceBudget(Genre);
+	OnReady.ExecuteIfBound(Wave);
+}
+
+void FMusicTrackStreamer::SetPinnedTrack(EMusicGenre Genre, const FSoftObjectPath& Track)
+{
+	Genres[static_cast<int32>(Genre)].Pinned = Track;
+}
+
+void FMusicTrackStreamer::SetGenreBudget(EMusicGenre Genre, int64 InBudgetBytes)
+{
+	Genres[static_cast<int32>(Genre)].BudgetBytes = FMath::Max<int64>(0, InBudgetBytes);
+	EnforceBudget(Genre);
+}
+
+int64 FMusicTrackStreamer::GetGenreResidentBytes(EMusicGenre Genre) const
+{
+	int64 Total = 0;
+	for (const FResidentTrack& Track : Genres[static_cast<int32>(Genre)].Tracks)
+	{
+		Total += Track.Bytes;
+	}
+	return Total;
+}
+
+void FMusicTrackStreamer::EnforceBudget(EMusicGenre Genre)
+{
+	FGenreCache& Cache = Genres[static_cast<int32>(Genre)];
+	int64 Total = GetGenreResidentBytes(Genre);
+
+	while (Total > Cache.BudgetBytes)
+	{
+		// Least recently used track that is neither playing nor queued up next.
+		int32 Victim = INDEX_NONE;
+		for (int32 Index = 0; Index < Cache.Tracks.Num(); ++Index)
+		{
+			const FResidentTrack& Track = Cache.Tracks[Index];
+			if (Track.Path == Cache.Pinned || Track.Path == Cache.Prefetched)
+			{
+				continue;
+			}
+			if (Victim == INDEX_NONE || Track.LastUsedTime < Cache.Tracks[Victim].LastUsedTime)
+			{
+				Victim = Index;
+			}
+		}
+
+		if (Victim == INDEX_NONE)
+		{
+			break;
+		}
+
+		Total -= Cache.Tracks[Victim].Bytes;
+		if (Cache.Tracks[Victim].Handle.IsValid())
+		{
+			Cache.Tracks[Victim].Handle->ReleaseHandle();
+		}
+		Cache.Tracks.RemoveAtSwap(Victim);
+	}
+}
+
+void FMusicTrackStreamer::ReleaseAll()
+{
+	for (FGenreCache& Cache : Genres)
+	{
+		for (FResidentTrack& Track : Cache.Tracks)
+		{
+			if (Track.Handle.IsValid())
+			{
+				Track.Handle->CancelHandle();
+			}
+		}
+		Cache.Tracks.Reset();
+		Cache.Pinned.Reset();
+		Cache.Prefetched.Reset();
+	}
+}
+
+void UMusicManager::OnInitializeAudio()
+{
+	MusicAudioData.LoadMusicAssets();
+}
+
+void UMusicManager::PlayGenre(UObject* WorldContextObject, EMusicGenre Genre)
+{
+	EnsureAudioInitialized();
+
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	if (!World || Genre == EMusicGenre::Count)
+	{
+#if DEV_DEBUG_MODE
+		LOG_ERROR("PlayGenre: World is NULL or genre is invalid!");
+#endif
+		return;
+	}
+
+	MusicWorld = World;
+	CurrentGenre = Genre;
+	QueuedTrack = nullptr;
+
+	RequestNextTrack(Genre, true);
+}
+
+void UMusicManager::StopMusic()
+{
+	if (PlaylistTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PlaylistTickHandle);
+		PlaylistTickHandle.Reset();
+	}
+
+	for (TObjectPtr<UAudioComponent>& Deck : Decks)
+	{
+		if (Deck)
+		{
+			Deck->Stop();
+		}
+	}
+
+	QueuedTrack = nullptr;
+	bFading = false;
+	bNextTrackRequested = false;
+	ActiveTrackDuration = 0.f;
+	bIntensityStarted = false;
+}
+
+void UMusicManager::SetGenreMemoryBudget(EMusicGenre Genre, int32 BudgetKilobytes)
+{
+	if (Genre != EMusicGenre::Count)
+	{
+		TrackStreamer.SetGenreBudget(Genre, static_cast<int64>(BudgetKilobytes) * 1024);
+	}
+}
+
+#pragma endregion
 
-    UGameplayStatics::PlaySound2D(WorldContextObject, Sound);
+#pragma region Playlist
 
+namespace
+{
+	constexpr int32 FadeCurveResolution = 256;
+
+	/** Equal-power gain for a fade-in at Alpha; the fade-out uses 1 - Alpha. */
+	TArray<float> BuildEqualPowerCurve()
+	{
+		TArray<float> Curve;
+		Curve.SetNumUninitialized(FadeCurveResolution + 1);
+		for (int32 Index = 0; Index <= FadeCurveResolution; ++Index)
+		{
+			Curve[Index] = FMath::Sin(HALF_PI * static_cast<float>(Index) / FadeCurveResolution);
+		}
+		return Curve;
+	}
+
+	/** Floor that keeps a fading voice audible to the mixer instead of being culled as silent. */
+	constexpr float MinFadeVolume = 0.001f;
 }
 
-void UAudioManager::PlaySoundAtLocation(UObject* WorldContextObject, USoundBase* Sound, FVector Location)
+void FMusicShuffleBag::Refill(int32 NumTracks, FRandomStream& Stream)
 {
-	if (!WorldContextObject)
+	Order.SetNumUninitialized(NumTracks);
+	for (int32 Index = 0; Index < NumTracks; ++Index)
 	{
-#if DEV_DEBUG_MODE
-		LOG_ERROR("PlaySoundAtLocation: WorldContextObject is NULL!");
-#endif
+		Order[Index] = Index;
 	}
-	if (!Sound)
+
+	// Fisher-Yates.
+	for (int32 Index = NumTracks - 1; Index > 0; --Index)
 	{
-#if DEV_DEBUG_MODE
-		LOG_ERROR("PlaySoundAtLocation: Sound is NULL!");
-#endif
+		Order.Swap(Index, Stream.RandRange(0, Index));
 	}
-	UGameplayStatics::PlaySoundAtLocation(WorldContextObject, Sound, Location);
-}
 
-#pragma endregion
+	// Avoid repeating the last track across the pass boundary.
+	if (NumTracks > 1 && Order[0] == LastPlayed)
+	{
+		Order.Swap(0, NumTracks - 1);
+	}
 
-#pragma endregion
+	Cursor = 0;
+}
 
-#pragma region UI
+int32 FMusicShuffleBag::Peek(int32 NumTracks, FRandomStream& Stream)
+{
+	if (NumTracks <= 0)
+	{
+		return INDEX_NONE;
+	}
 
-#pragma region Constructor
+	if (Order.Num() != NumTracks || Cursor >= Order.Num())
+	{
+		Refill(NumTracks, Stream);
+	}
+	return Order[Cursor];
+}
 
-UUIAudioManager::UUIAudioManager(const FObjectInitializer& ObjectInitializer)
-: Super(ObjectInitializer)
+int32 FMusicShuffleBag::Next(int32 NumTracks, FRandomStream& Stream)
 {
-
+	const int32 Index = Peek(NumTracks, Stream);
+	if (Index != INDEX_NONE)
+	{
+		++Cursor;
+		LastPlayed = Index;
+	}
+	return Index;
 }
 
-#pragma endregion
+TSoftObjectPtr<USoundWave> UMusicManager::PickNextTrack(EMusicGenre Genre, bool bAdvance)
+{
+	TArray<TSoftObjectPtr<USoundWave>> Tracks;
+	MusicAudioData.GetBackgroundMusic().GatherTracks(Genre, Tracks);
 
-#pragma region PlayUIAudio
+	FMusicShuffleBag& Bag = ShuffleBags[static_cast<int32>(Genre)];
+	const int32 Index = bAdvance ? Bag.Next(Tracks.Num(), ShuffleStream) : Bag.Peek(Tracks.Num(), ShuffleStream);
+	return Tracks.IsValidIndex(Index) ? Tracks[Index] : TSoftObjectPtr<USoundWave>();
+}
 
-void UUIAudioManager::PlayHoveredSound(UWorld* InWorldContext)
+void UMusicManager::SetCrossfadeDuration(float InSeconds)
 {
-	// Check if the world context is valid before proceeding.
-	if (InWorldContext == nullptr)
+	CrossfadeDuration = FMath::Max(0.f, InSeconds);
+}
+
+void UMusicManager::RequestNextTrack(EMusicGenre Genre, bool bImmediate)
+{
+	const TSoftObjectPtr<USoundWave> Track = PickNextTrack(Genre, true);
+	if (Track.IsNull())
 	{
-		#if DEV_DEBUG_MODE
-			LOG_ERROR("World context is null. Cannot play hovered sound.");
-		#endif
+		return;
 	}
 
-	// Ensure a hovered sound is set in the UI audio data.
-	if (UIAudioData.GetHoveredSound() == nullptr)
+	bNextTrackRequested = true;
+
+	if (!PlaylistTickHandle.IsValid())
 	{
-		#if DEV_DEBUG_MODE
-			LOG_INVALID("Hovered sound is not assigned in UIAudioData.");
-		#else
-			LOG_FATAL_USER();
-		#endif
+		ShuffleStream.Initialize(static_cast<int32>(FPlatformTime::Cycles()));
+		FadeCurveTask = Async(EAsyncExecution::ThreadPool, &BuildEqualPowerCurve);
+		PlaylistTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UMusicManager::TickPlaylist));
 	}
 
-	// Play the assigned hovered sound using the provided world context.
-	PlaySound(InWorldContext, UIAudioData.GetHoveredSound());
+	TrackStreamer.SetPinnedTrack(Genre, Track.ToSoftObjectPath());
+	TrackStreamer.RequestTrack(Genre, Track,
+		FMusicTrackStreamer::FOnTrackReady::CreateUObject(this, &UMusicManager::HandleTrackReady, Genre, bImmediate));
+
+	// Queue the likely successor while this one plays.
+	TrackStreamer.PrefetchTrack(Genre, PickNextTrack(Genre, false));
 }
 
-void UUIAudioManager::PlayPressedSound(UWorld* InWorldContext)
+void UMusicManager::HandleTrackReady(USoundWave* Track, EMusicGenre Genre, bool bImmediate)
 {
-	// Check if the world context is valid before proceeding.
-	if (InWorldContext == nullptr)
+	// A genre switch superseded this request; the newer one owns the playlist state.
+	UWorld* World = MusicWorld.Get();
+	if (!World || Genre != CurrentGenre)
 	{
-#if DEV_DEBUG_MODE
-		LOG_ERROR("World context is null. Cannot play pressed sound.");
-#endif
 		return;
 	}
 
-	// Ensure a pressed sound is set in the UI audio data.
-	if (UIAudioData.GetPressedSound() == nullptr)
+	// Failed loads stall the playlist until the next PlayGenre rather than retrying every frame.
+	if (!Track)
 	{
-#if DEV_DEBUG_MODE
-		LOG_INVALID("Pressed sound is not assigned in UIAudioData.");
-#else
-		LOG_FATAL_USER();
-#endif
 		return;
 	}
 
-	// Play the assigned pressed sound using the provided world context.
-	PlaySound(InWorldContext, UIAudioData.GetPressedSound());
+	if (bImmediate)
+	{
+		StartOnIncomingDeck(World, Track);
+		return;
+	}
+
+	// Decoding starts now; TickPlaylist starts it on the transition frame.
+	UGameplayStatics::PrimeSound(Track);
+	QueuedTrack = Track;
 }
 
-void UUIAudioManager::PlaySelectSound(UWorld* InWorldContext)
+void UMusicManager::StartOnIncomingDeck(UWorld* World, USoundWave* Track)
 {
-	// Check if the world context is valid before proceeding.
-	if (InWorldContext == nullptr)
+	for (TObjectPtr<UAudioComponent>& Deck : Decks)
 	{
-#if DEV_DEBUG_MODE
-		LOG_ERROR("World context is null. Cannot play select sound.");
-#endif
-		return;
+		if (!Deck || Deck->GetWorld() != World)
+		{
+			Deck = UGameplayStatics::CreateSound2D(World, nullptr, 1.f, 1.f, 0.f, nullptr, true, false);
+		}
 	}
 
-	// Ensure a select sound is set in the UI audio data.
-	if (UIAudioData.GetSelectSound() == nullptr)
+	const int32 IncomingDeck = 1 - ActiveDeck;
+	UAudioComponent* Incoming = Decks[IncomingDeck];
+	UAudioComponent* Outgoing = Decks[ActiveDeck];
+	if (!Incoming)
 	{
-#if DEV_DEBUG_MODE
-		LOG_INVALID("Select sound is not assigned in UIAudioData.");
-#else
-		LOG_FATAL_USER();
-#endif
 		return;
 	}
 
-	// Play the assigned select sound using the provided world context.
-	PlaySound(InWorldContext, UIAudioData.GetSelectSound());
+	ActiveCrossfade = GetNextCrossfade();
+	NextCrossfadeOverride = -1.f;
+
+	const bool bCrossfade = ActiveCrossfade > 0.f && Outgoing && Outgoing->IsPlaying();
+
+	Incoming->Stop();
+	Incoming->SetSound(Track);
+	Incoming->SetVolumeMultiplier(bCrossfade ? MinFadeVolume : 1.f);
+	Incoming->Play(0.f);
+
+	if (!bCrossfade && Outgoing)
+	{
+		Outgoing->Stop();
+	}
+
+	ActiveDeck = IncomingDeck;
+	ActiveTrackStartTime = World->GetAudioTimeSeconds();
+	ActiveTrackDuration = Track->Duration;
+	bNextTrackRequested = false;
+	QueuedTrack = nullptr;
+
+	bFading = bCrossfade;
+	FadeStartTime = ActiveTrackStartTime;
 }
 
-void UUIAudioManager::PlayExitSound(UWorld* InWorldContext)
+float UMusicManager::GetFadeGain(float Alpha)
 {
-	// Check if the world context is valid before proceeding.
-	if (InWorldContext == nullptr)
+	Alpha = FMath::Clamp(Alpha, 0.f, 1.f);
+
+	if (FadeCurve.Num() == 0 && FadeCurveTask.IsValid() && FadeCurveTask.IsReady())
 	{
-#if DEV_DEBUG_MODE
-		LOG_ERROR("World context is null. Cannot play exit sound.");
-#endif
-		return;
+		FadeCurve = FadeCurveTask.Get();
+		FadeCurveTask.Reset();
 	}
 
-	// Ensure an exit sound is set in the UI audio data.
-	if (UIAudioData.GetExitSound() == nullptr)
+	// Table not back from the worker yet: evaluate directly for this frame.
+	if (FadeCurve.Num() == 0)
 	{
-#if DEV_DEBUG_MODE
-		LOG_INVALID("Exit sound is not assigned in UIAudioData.");
-#else
-		LOG_FATAL_USER();
-#endif
-		return;
+		return FMath::Sin(HALF_PI * Alpha);
 	}
 
-	// Play the assigned exit sound using the provided world context.
-	PlaySound(InWorldContext, UIAudioData.GetExitSound());
+	return FadeCurve[FMath::RoundToInt(Alpha * FadeCurveResolution)];
 }
 
-void UUIAudioManager::PlaySliderIncreaseSound(UWorld* InWorldContext)
+bool UMusicManager::TickPlaylist(float DeltaTime)
 {
-	// Check if the world context is valid before proceeding.
-	if (InWorldContext == nullptr)
+	UWorld* World = MusicWorld.Get();
+	if (World == nullptr)
 	{
-#if DEV_DEBUG_MODE
-		LOG_ERROR("World context is null. Cannot play slider increase sound.");
-#endif
-		return;
+		return true;
 	}
 
-	// Ensure a slider increase sound is set in the UI audio data.
-	if (UIAudioData.GetSliderIncreaseSound() == nullptr)
+	const double Now = World->GetAudioTimeSeconds();
+	UAudioComponent* Active = Decks[ActiveDeck];
+
+	if (bFading)
 	{
-#if DEV_DEBUG_MODE
-		LOG_INVALID("Slider increase sound is not assigned in UIAudioData.");
-#else
-		LOG_FATAL_USER();
-#endif
-		return;
+		const float Alpha = ActiveCrossfade > 0.f ? static_cast<float>((Now - FadeStartTime) / ActiveCrossfade) : 1.f;
+		UAudioComponent* Outgoing = Decks[1 - ActiveDeck];
+
+		if (Alpha >= 1.f)
+		{
+			if (Active)
+			{
+				Active->SetVolumeMultiplier(1.f);
+			}
+			if (Outgoing)
+			{
+				Outgoing->Stop();
+			}
+			bFading = false;
+		}
+		else
+		{
+			if (Active)
+			{
+				Active->SetVolumeMultiplier(FMath::Max(MinFadeVolume, GetFadeGain(Alpha)));
+			}
+			if (Outgoing)
+			{
+				Outgoing->SetVolumeMultiplier(FMath::Max(MinFadeVolume, GetFadeGain(1.f - Alpha)));
+			}
+		}
 	}
 
-	// Play the assigned slider increase sound using the provided world context.
-	PlaySound(InWorldContext, UIAudioData.GetSliderIncreaseSound());
-}
+	// Transition point: the crossfade ends exactly where the active track does. Uses the length the
+	// transition will actually run with, which an intensity change may have overridden.
+	const double TransitionTime = ActiveTrackStartTime + ActiveTrackDuration - GetNextCrossfade();
 
-void UUIAudioManager::PlaySliderDecreaseSound(UWorld* InWorldContext)
-{
-	// Check if the world context is valid before proceeding.
-	if (InWorldContext == nullptr)
+	if (!bNextTrackRequested && !QueuedTrack && ActiveTrackDuration > 0.f && Now >= TransitionTime - TransitionLookahead)
 	{
-#if DEV_DEBUG_MODE
-		LOG_ERROR("World context is null. Cannot play slider decrease sound.");
-#endif
-		return;
+		RequestNextTrack(CurrentGenre, false);
 	}
 
-	// Ensure a slider decrease sound is set in the UI audio data.
-	if (UIAudioData.GetSliderDecreaseSound() == nullptr)
+	const bool bActiveFinished = !Active || !Active->IsPlaying();
+	if (QueuedTrack && (Now >= TransitionTime || bActiveFinished))
 	{
-#if DEV_DEBUG_MODE
-		LOG_INVALID("Slider decrease sound is not assigned in UIAudioData.");
-#else
-		LOG_FATAL_USER();
-#endif
-		return;
+		StartOnIncomingDeck(World, QueuedTrack);
+	}
+	else if (bActiveFinished && !bFading && !bNextTrackRequested && !QueuedTrack)
+	{
+		// Unknown duration or the track was stopped from outside: move on straight away.
+		RequestNextTrack(CurrentGenre, true);
 	}
 
-	// Play the assigned slider decrease sound using the provided world context.
-	PlaySound(InWorldContext, UIAudioData.GetSliderDecreaseSound());
+	return true;
 }
 
-void UUIAudioManager::PlayErrorSound(UWorld* InWorldContext)
+#pragma endregion
+
+#pragma region Intensity
+
+namespace
 {
-	// Check if the world context is valid before proceeding.
-	if (InWorldContext == nullptr)
+	EMusicGenre GetIntensityGenre(EMusicIntensityState State)
 	{
-#if DEV_DEBUG_MODE
-		LOG_ERROR("World context is null. Cannot play error sound.");
-#endif
-		return;
+		switch (State)
+		{
+		case EMusicIntensityState::Calm:	return EMusicGenre::Calm;
+		case EMusicIntensityState::Intense:	return EMusicGenre::Intense;
+		default:							return EMusicGenre::Ambient;
+		}
 	}
+}
+
+void UMusicManager::RebuildIntensityTable()
+{
+	constexpr int32 NumStates = static_cast<int32>(EMusicIntensityState::Count);
+	const float RiseThresholds[NumStates - 1] = { AmbientThreshold, IntenseThreshold };
 
-	// Ensure an error sound is set in the UI audio data.
-	if (UIAudioData.GetErrorSound() == nullptr)
+	for (int32 Current = 0; Current < NumStates; ++Current)
 	{
-#if DEV_DEBUG_MODE
-		LOG_INVALID("Error sound is not assigned in UIAudioData.");
-#else
-		LOG_FATAL_USER();
-#endif
-		return;
+		for (int32 Bucket = 0; Bucket < IntensityResolution; ++Bucket)
+		{
+			const float Intensity = (Bucket + 0.5f) / IntensityResolution;
+
+			// Rising uses the thresholds as is, falling needs to clear them by the hysteresis margin.
+			int32 Desired = Current;
+			while (Desired < NumStates - 1 && Intensity >= RiseThresholds[Desired])
+			{
+				++Desired;
+			}
+			while (Desired > 0 && Intensity < RiseThresholds[Desired - 1] - IntensityHysteresis)
+			{
+				--Desired;
+			}
+
+			// Disallowed direct transitions route through a state that may bridge them.
+			int32 Next = Desired;
+			if (Desired != Current && !GetTransitionRule(static_cast<EMusicIntensityState>(Current), static_cast<EMusicIntensityState>(Desired)).bAllowed)
+			{
+				Next = Current;
+				for (int32 Bridge = 0; Bridge < NumStates; ++Bridge)
+				{
+					if (Bridge != Current && Bridge != Desired
+						&& GetTransitionRule(static_cast<EMusicIntensityState>(Current), static_cast<EMusicIntensityState>(Bridge)).bAllowed
+						&& GetTransitionRule(static_cast<EMusicIntensityState>(Bridge), static_cast<EMusicIntensityState>(Desired)).bAllowed)
+					{
+						Next = Bridge;
+						break;
+					}
+				}
+			}
+
+			IntensityTable[Current][Bucket] = static_cast<uint8>(Next);
+		}
 	}
 
-	// Play the assigned error sound using the provided world context.
-	PlaySound(InWorldContext, UIAudioData.GetErrorSound());
+	bIntensityTableBuilt = true;
 }
 
-void UUIAudioManager::PlayAcceptSound(UWorld* InWorldContext)
+void UMusicManager::SetIntensity(UObject* WorldContextObject, float Intensity)
 {
-	// Check if the world context is valid before proceeding.
-	if (InWorldContext == nullptr)
+	if (!bIntensityTableBuilt)
 	{
-#if DEV_DEBUG_MODE
-		LOG_ERROR("World context is null. Cannot play accept sound.");
-#endif
-		return;
+		RebuildIntensityTable();
 	}
 
-	// Ensure an accept sound is set in the UI audio data.
-	if (UIAudioData.GetAcceptSound() == nullptr)
+	const int32 Bucket = FMath::Clamp(static_cast<int32>(Intensity * IntensityResolution), 0, IntensityResolution - 1);
+	const EMusicIntensityState Next = static_cast<EMusicIntensityState>(IntensityTable[static_cast<int32>(IntensityState)][Bucket]);
+
+	const double Now = FPlatformTime::Seconds();
+
+	// First call starts the music in whatever state the intensity maps to.
+	if (!bIntensityStarted)
 	{
-#if DEV_DEBUG_MODE
-		LOG_INVALID("Accept sound is not assigned in UIAudioData.");
-#else
-		LOG_FATAL_USER();
-#endif
+		bIntensityStarted = true;
+		IntensityState = Next;
+		LastStateChangeTime = Now;
+		PlayGenre(WorldContextObject, GetIntensityGenre(Next));
 		return;
 	}
 
-	// Play the assigned accept sound using the provided world context.
-	PlaySound(InWorldContext, UIAudioData.GetAcceptSound());
+	if (Next == IntensityState || Now - LastStateChangeTime < MinStateDuration)
+	{
+		return;
+	}
 
+	NextCrossfadeOverride = GetTransitionRule(IntensityState, Next).CrossfadeSeconds;
+	IntensityState = Next;
+	LastStateChangeTime = Now;
+	PlayGenre(WorldContextObject, GetIntensityGenre(Next));
 }
 
 #pragma endregion
 
 #pragma endregion
 
-#pragma region Utility
+#pragma region Benchmark
 
-#pragma region Constructor
+#if !UE_BUILD_SHIPPING
 
-UUtilityAudioManager::UUtilityAudioManager(const FObjectInitializer& ObjectInitializer)
-: Super(ObjectInitializer)
+namespace
 {
-}
+	struct FAudioBenchmarkResult
+	{
+		FString Name;
+		int32 Iterations = 0;
+		double FirstMs = 0.0;
+		double TotalMs = 0.0;
+		double MinMs = TNumericLimits<double>::Max();
+		double MaxMs = 0.0;
+		int64 MemoryDeltaBytes = 0;
+		int32 UObjectDelta = 0;
+	};
 
-#pragma endregion
+	/** Times Iterations calls of Body. The first run is reported separately as the cold cost. */
+	template <typename BodyType>
+	FAudioBenchmarkResult RunAudioBenchmark(const TCHAR* Name, int32 Iterations, BodyType&& Body)
+	{
+		FAudioBenchmarkResult Result;
+		Result.Name = Name;
+		Result.Iterations = Iterations;
 
-#pragma region PlayUtilityAudio
+		const uint64 UsedBefore = FPlatformMemory::GetStats().UsedPhysical;
+		const int32 ObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
 
-#pragma region Weapon
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			const double Start = FPlatformTime::Seconds();
+			Body();
+			const double Ms = (FPlatformTime::Seconds() - Start) * 1000.0;
 
-#pragma region Rifle 
+			if (Iteration == 0)
+			{
+				Result.FirstMs = Ms;
+			}
+			Result.TotalMs += Ms;
+			Result.MinMs = FMath::Min(Result.MinMs, Ms);
+			Result.MaxMs = FMath::Max(Result.MaxMs, Ms);
+		}
 
-void UUtilityAudioManager::PlayRifleFire(UWorld* InWorldContext)
-{
-	// Check if the world context is valid before proceeding.
-	if (InWorldContext == nullptr)
-	{
-		#if DEV_DEBUG_MODE
-			LOG_ERROR("World context is null. Cannot play rifle fire sound.");
-		#endif
-		return;
+		Result.MemoryDeltaBytes = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(UsedBefore);
+		Result.UObjectDelta = GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsBefore;
+		return Result;
 	}
 
-	// Ensure rifle fire sound is set in the utility audio data.
-	if (UtilityAudioData.GetRifleFire() == nullptr)
+	/** Construction plus explicit initialization, so the timing covers the asset work moved out of the constructors. */
+	template <typename ManagerType>
+	void ConstructAndDiscardManager()
 	{
-		#if DEV_DEBUG_MODE
-			LOG_ERROR("Rifle fire sound is not assigned in UtilityAudioData.");
-		#else
-			LOG_FATAL_USER();
-		#endif
-		return;
+		ManagerType* Manager = NewObject<ManagerType>(GetTransientPackage());
+		Manager->InitializeAudio();
+		Manager->MarkAsGarbage();
 	}
 
-	#if DEV_DEBUG_MODE
-		LOG_INFO("Rifle fire sound has been played successfully.");
-	#endif
+	/**
+	 * audio.BenchmarkStartup [Iterations] : constructs every audio data struct and manager
+	 * Iterations times and loads each known sound once, then writes the timings as JSON to
+	 * Saved/Profiling/AudioStartupBenchmark.json. Meant for headless runs, e.g.
+	 * -nullrhi -nosound -ExecCmds="audio.BenchmarkStartup 100,quit".
+	 */
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice AudioBenchmarkStartupCommand(
+		TEXT("audio.BenchmarkStartup"),
+		TEXT("Times construction of the audio data structs and managers and writes JSON to Saved/Profiling."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+		{
+			const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100;
 
-	// Play the assigned rifle fire sound using the provided world context.
-	PlaySound(InWorldContext, UtilityAudioData.GetRifleFire());
-}
+			// Per-asset load cost, measured before the struct runs below warm the cache.
+			FString AssetsJson;
+			auto TimeAssetLoad = [&AssetsJson](const TCHAR* Path)
+			{
+				const FSoftObjectPath SoftPath = FSoundAssetCache::ResolvePath(MakeSoundId(Path), Path);
+				const bool bWasResident = SoftPath.ResolveObject() != nullptr;
 
-void UUtilityAudioManager::PlayRifleReloadStart(UWorld* InWorldContext)
-{
-	// Check if the world context is valid before proceeding.
-	if (InWorldContext == nullptr)
-	{
-		#if DEV_DEBUG_MODE
-				LOG_ERROR("World context is null. Cannot play rifle reload start sound.");
-		#endif
-		return;
-	}
+				const double Start = FPlatformTime::Seconds();
+				const bool bLoaded = SoftPath.TryLoad() != nullptr;
+				const double Ms = (FPlatformTime::Seconds() - Start) * 1000.0;
 
-	// Ensure rifle reload start sound is set in the utility audio data.
-	if (UtilityAudioData.GetRifleReloadStart() == nullptr)
-	{
-		#if DEV_DEBUG_MODE
-				LOG_ERROR("Rifle reload start sound is not assigned in UtilityAudioData.");
-		#else
-				LOG_FATAL_USER();
-		#endif
-		return;
-	}
+				AssetsJson += FString::Printf(TEXT("%s\n    { \"path\": \"%s\", \"loaded\": %s, \"was_resident\": %s, \"ms\": %.4f }"),
+					AssetsJson.IsEmpty() ? TEXT("") : TEXT(","), Path,
+					bLoaded ? TEXT("true") : TEXT("false"), bWasResident ? TEXT("true") : TEXT("false"), Ms);
+			};
+			for (const FUISoundInfo& Info : GUISoundTable)
+			{
+				if (Info.Path != nullptr)
+				{
+					TimeAssetLoad(Info.Path);
+				}
+			}
+			TimeAssetLoad(FEnvironmentAudioData::WindSoundPath);
+			TimeAssetLoad(FEnvironmentAudioData::RainSoundPath);
+			TimeAssetLoad(FEnvironmentAudioData::ThunderSoundPath);
+			TimeAssetLoad(FEnvironmentAudioData::ForestAmbientSoundPath);
+			TimeAssetLoad(FUtilityAudioData::RifleFirePath);
+			TimeAssetLoad(FUtilityAudioData::RifleAutoFireLoopPath);
 
-	#if DEV_DEBUG_MODE
-		LOG_INFO("Rifle reload start sound has been played successfully.");
-	#endif
+			TArray<FAudioBenchmarkResult> Results;
+			Results.Add(RunAudioBenchmark(TEXT("FUIAudioData"), Iterations, [] { FUIAudioData Data; }));
+			Results.Add(RunAudioBenchmark(TEXT("FEnvironmentAudioData"), Iterations, [] { FEnvironmentAudioData Data; }));
+			Results.Add(RunAudioBenchmark(TEXT("FUtilityAudioData"), Iterations, [] { FUtilityAudioData Data; }));
+			Results.Add(RunAudioBenchmark(TEXT("FMusicAudioData"), Iterations, [] { FMusicAudioData Data; }));
+			Results.Add(RunAudioBenchmark(TEXT("UUIAudioManager"), Iterations, &ConstructAndDiscardManager<UUIAudioManager>));
+			Results.Add(RunAudioBenchmark(TEXT("UUtilityAudioManager"), Iterations, &ConstructAndDiscardManager<UUtilityAudioManager>));
+			Results.Add(RunAudioBenchmark(TEXT("UCharacterAudioManager"), Iterations, &ConstructAndDiscardManager<UCharacterAudioManager>));
+			Results.Add(RunAudioBenchmark(TEXT("UEnvironmentAudioManager"), Iterations, &ConstructAndDiscardManager<UEnvironmentAudioManager>));
+			Results.Add(RunAudioBenchmark(TEXT("UMusicManager"), Iterations, &ConstructAndDiscardManager<UMusicManager>));
 
-	// Play the assigned rifle reload start sound using the provided world context.
-	PlaySound(InWorldContext, UtilityAudioData.GetRifleReloadStart());
-}
+			FString Json = FString::Printf(TEXT("{\n  \"iterations\": %d,\n  \"constructors\": ["), Iterations);
+			for (int32 Index = 0; Index < Results.Num(); ++Index)
+			{
+				const FAudioBenchmarkResult& Result = Results[Index];
+				Json += FString::Printf(
+					TEXT("%s\n    { \"name\": \"%s\", \"first_ms\": %.4f, \"mean_ms\": %.4f, \"min_ms\": %.4f, \"max_ms\": %.4f, \"total_ms\": %.4f, \"memory_delta_bytes\": %lld, \"uobject_delta\": %d }"),
+					Index > 0 ? TEXT(",") : TEXT(""), *Result.Name, Result.FirstMs, Result.TotalMs / Result.Iterations,
+					Result.MinMs, Result.MaxMs, Result.TotalMs, Result.MemoryDeltaBytes, Result.UObjectDelta);
 
-void UUtilityAudioManager::PlayRifleReloadStop(UWorld* InWorldContext)
-{
-	// Check if the world context is valid before proceeding.
-	if (InWorldContext == nullptr)
+				Ar.Logf(TEXT("%-26s first %8.3f ms  mean %8.4f ms  mem %+lld B  uobjects %+d"),
+					*Result.Name, Result.FirstMs, Result.TotalMs / Result.Iterations, Result.MemoryDeltaBytes, Result.UObjectDelta);
+			}
+			Json += TEXT("\n  ],\n  \"assets\": [");
+			Json += AssetsJson;
+			Json += TEXT("\n  ]\n}\n");
+
+			const FString OutPath = FPaths::ProjectSavedDir() / TEXT("Profiling/AudioStartupBenchmark.json");
+			if (FFileHelper::SaveStringToFile(Json, *OutPath))
+			{
+				Ar.Logf(TEXT("Audio startup benchmark written to %s"), *OutPath);
+			}
+
+			// Per-class totals, including the first initialization, which is the one that loads.
+			UAudioManager::DumpInitStats(Ar);
+		}));
+
+	enum class EPlayBenchmarkScenario : uint8
 	{
-		#if DEV_DEBUG_MODE
-				LOG_ERROR("World context is null. Cannot play rifle reload stop sound.");
-		#endif
-		return;
-	}
+		PlaySound,
+		PlaySoundAtLocation,
+		PlayUISound,
+		PlayRifleFire,
+		Count
+	};
 
-	// Ensure rifle reload stop sound is set in the utility audio data.
-	if (UtilityAudioData.GetRifleReloadEnd() == nullptr)
+	const TCHAR* GetScenarioName(EPlayBenchmarkScenario Scenario)
 	{
-		#if DEV_DEBUG_MODE
-			LOG_ERROR("Rifle reload stop sound is not assigned in UtilityAudioData.");
-		#else
-			LOG_FATAL_USER();
-		#endif
-		return;
+		switch (Scenario)
+		{
+		case EPlayBenchmarkScenario::PlaySound:				return TEXT("UAudioManager::PlaySound");
+		case EPlayBenchmarkScenario::PlaySoundAtLocation:	return TEXT("UAudioManager::PlaySoundAtLocation");
+		case EPlayBenchmarkScenario::PlayUISound:			return TEXT("UUIAudioManager::PlayUISound");
+		case EPlayBenchmarkScenario::PlayRifleFire:			return TEXT("UtilityAudio::PlayRifleFire");
+		default:											return TEXT("Unknown");
+		}
 	}
 
-	#if DEV_DEBUG_MODE
-		LOG_INFO("Rifle reload stop sound has been played successfully.");
-	#endif
+	/**
+	 * Drives the play paths at fixed request rates from a core ticker, one (scenario, rate) pair
+	 * at a time, and measures game-thread cost per call, audio-thread command latency and
+	 * peak active sounds.
+	 */
+	struct FPlaySoundBenchmark
+	{
+		struct FRun
+		{
+			EPlayBenchmarkScenario Scenario = EPlayBenchmarkScenario::PlaySound;
+			int32 Rate = 0;
+			int64 Calls = 0;
+			double GameThreadMs = 0.0;
+			double FenceTotalMs = 0.0;
+			double FenceMaxMs = 0.0;
+			int32 FenceSamples = 0;
+			int32 PeakActiveSounds = 0;
+			uint64 Rejected = 0;
+			uint64 Culled = 0;
+			bool bSkipped = false;
+		};
 
-	// Play the assigned rifle reload stop sound using the provided world context.
-	PlaySound(InWorldContext, UtilityAudioData.GetRifleReloadEnd());
-}
+		/** How long a run waits for its sound to stream in before it is skipped */
+		static constexpr double MaxAssetWaitSeconds = 10.0;
 
+		TWeakObjectPtr<UWorld> World;
+		TStrongObjectPtr<UUIAudioManager> UIManager;
+		FCachedSound Sound;
+		TArray<FRun> Runs;
+		int32 CurrentRun = 0;
+		double RunStartTime = 0.0;
+		double RunSeconds = 2.0;
+		double RequestBudget = 0.0;
+		uint64 RejectedAtStart = 0;
+		uint64 CulledAtStart = 0;
+		bool bRunActive = false;
+		double WaitStartTime = 0.0;
+		FAudioCommandFence Fence;
+		bool bFencePending = false;
+		double FenceStartTime = 0.0;
+		FRandomStream Random;
+		FTSTicker::FDelegateHandle TickHandle;
 
+		bool IsRunning() const { return TickHandle.IsValid(); }
 
-#pragma endregion
+		void Start(UWorld* InWorld, TConstArrayView<int32> Rates, double InRunSeconds)
+		{
+			World = InWorld;
+			RunSeconds = InRunSeconds;
+			Sound = FCachedSound(GetUISoundInfo(EUISound::Hovered).Path);
+			UIManager.Reset(NewObject<UUIAudioManager>(GetTransientPackage()));
+			Random.Initialize(0x5eed);
 
-#pragma endregion
+			Runs.Reset();
+			for (int32 Scenario = 0; Scenario < static_cast<int32>(EPlayBenchmarkScenario::Count); ++Scenario)
+			{
+				for (const int32 Rate : Rates)
+				{
+					FRun& Run = Runs.AddDefaulted_GetRef();
+					Run.Scenario = static_cast<EPlayBenchmarkScenario>(Scenario);
+					Run.Rate = Rate;
+				}
+			}
 
-#pragma endregion
+			// Cache misses stream in asynchronously; start the loads now so the first runs do not wait long.
+			Sound.Prefetch();
+			UtilityAudio::GetUtilityAudioData();
 
-#pragma endregion
+			CurrentRun = 0;
+			PrepareRun();
+			TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FPlaySoundBenchmark::Tick));
+		}
 
-#pragma region Character
+		/** Waits for the run's sound before BeginRun, so the run measures playback rather than misses. */
+		void PrepareRun()
+		{
+			bRunActive = false;
+			WaitStartTime = FPlatformTime::Seconds();
+		}
 
-UCharacterAudioManager::UCharacterAudioManager(const FObjectInitializer& ObjectInitializer)
-: Super(ObjectInitializer)
-{
+		void BeginRun()
+		{
+			bRunActive = true;
+			RunStartTime = FPlatformTime::Seconds();
+			RequestBudget = 0.0;
+			RejectedAtStart = UAudioManager::GetRejectedVoiceCount();
+			CulledAtStart = UAudioManager::GetCulledSoundCount();
 
-}
+			// A fence issued during the previous run would be attributed to this one.
+			bFencePending = false;
+		}
 
-#pragma endregion
+		bool AdvanceRun()
+		{
+			if (++CurrentRun < Runs.Num())
+			{
+				PrepareRun();
+				return true;
+			}
 
-#pragma region Environment
+			Finish();
+			return false;
+		}
 
+		bool IsScenarioReady(UWorld* InWorld, EPlayBenchmarkScenario Scenario)
+		{
+			if (Scenario != EPlayBenchmarkScenario::PlayRifleFire)
+			{
+				// PlayUISound plays the same Hovered asset.
+				return Sound.Get() != nullptr;
+			}
 
-UEnvironmentAudioManager::UEnvironmentAudioManager(const FObjectInitializer& ObjectInitializer)
-: Super(ObjectInitializer)
-{
+			USoundBase* RifleFire = UtilityAudio::GetUtilityAudioData().GetRifleFire();
+			if (RifleFire == nullptr)
+			{
+				return false;
+			}
 
-}
+			// Voices are created up front so the run measures replay, not component creation.
+			UtilityAudio::GetRifleFireVoicePool().Prewarm(InWorld, RifleFire);
+			return true;
+		}
 
-#pragma endregion
+		void Issue(UWorld* InWorld, EPlayBenchmarkScenario Scenario)
+		{
+			switch (Scenario)
+			{
+			case EPlayBenchmarkScenario::PlaySound:
+				UAudioManager::PlaySound(InWorld, Sound.Get(), EAudioCategory::Utility);
+				break;
+			case EPlayBenchmarkScenario::PlaySoundAtLocation:
+				UAudioManager::PlaySoundAtLocation(InWorld, Sound.Get(), FVector(Random.FRandRange(-5000.f, 5000.f), Random.FRandRange(-5000.f, 5000.f), 0.f));
+				break;
+			case EPlayBenchmarkScenario::PlayUISound:
+				UIManager->PlayUISound(InWorld, EUISound::Hovered);
+				break;
+			case EPlayBenchmarkScenario::PlayRifleFire:
+				UtilityAudio::PlayRifleFire(InWorld);
+				break;
+			default:
+				break;
+			}
+		}
 
-#pragma region Music
+		bool Tick(float DeltaTime)
+		{
+			UWorld* InWorld = World.Get();
+			if (InWorld == nullptr)
+			{
+				Finish();
+				return false;
+			}
 
-UMusicManager::UMusicManager(const FObjectInitializer& ObjectInitializer)
-: Super(ObjectInitializer)
-{
+			FRun& Run = Runs[CurrentRun];
+
+			if (!bRunActive)
+			{
+				if (IsScenarioReady(InWorld, Run.Scenario))
+				{
+					BeginRun();
+				}
+				else if (FPlatformTime::Seconds() - WaitStartTime < MaxAssetWaitSeconds)
+				{
+					return true;
+				}
+				else
+				{
+					Run.bSkipped = true;
+					return AdvanceRun();
+				}
+			}
+
+			RequestBudget += Run.Rate * DeltaTime;
+			const int32 NumCalls = static_cast<int32>(RequestBudget);
+			RequestBudget -= NumCalls;
+
+			const double CallStart = FPlatformTime::Seconds();
+			for (int32 Call = 0; Call < NumCalls; ++Call)
+			{
+				Issue(InWorld, Run.Scenario);
+			}
+			Run.GameThreadMs += (FPlatformTime::Seconds() - CallStart) * 1000.0;
+			Run.Calls += NumCalls;
+
+			// Round trip through the audio thread command queue: grows with audio-thread load.
+			// The fence is read on a later tick rather than waited on, so samples have one-tick resolution.
+			const double Now = FPlatformTime::Seconds();
+			if (bFencePending && Fence.IsFenceComplete())
+			{
+				const double FenceMs = (Now - FenceStartTime) * 1000.0;
+				Run.FenceTotalMs += FenceMs;
+				Run.FenceMaxMs = FMath::Max(Run.FenceMaxMs, FenceMs);
+				++Run.FenceSamples;
+				bFencePending = false;
+			}
+			if (!bFencePending)
+			{
+				Fence.BeginFence();
+				FenceStartTime = Now;
+				bFencePending = true;
+			}
+
+			if (FAudioDevice* AudioDevice = InWorld->GetAudioDeviceRaw())
+			{
+				Run.PeakActiveSounds = FMath::Max(Run.PeakActiveSounds, AudioDevice->GetNumActiveSounds());
+			}
+
+			if (FPlatformTime::Seconds() - RunStartTime < RunSeconds)
+			{
+				return true;
+			}
 
+			Run.Rejected = UAudioManager::GetRejectedVoiceCount() - RejectedAtStart;
+			Run.Culled = UAudioManager::GetCulledSoundCount() - CulledAtStart;
+
+			return AdvanceRun();
+		}
+
+		void Finish()
+		{
+			TickHandle.Reset();
+			UIManager.Reset();
+
+			FString Json = FString::Printf(TEXT("{\n  \"run_seconds\": %.2f,\n  \"runs\": ["), RunSeconds);
+			for (int32 Index = 0; Index < Runs.Num(); ++Index)
+			{
+				const FRun& Run = Runs[Index];
+				const double NsPerCall = Run.Calls > 0 ? Run.GameThreadMs * 1.0e6 / Run.Calls : 0.0;
+				const double FenceMeanMs = Run.FenceSamples > 0 ? Run.FenceTotalMs / Run.FenceSamples : 0.0;
+
+				Json += FString::Printf(
+					TEXT("%s\n    { \"scenario\": \"%s\", \"rate\": %d, \"skipped\": %s, \"calls\": %lld, \"game_thread_ns_per_call\": %.1f, \"game_thread_ms\": %.3f, \"audio_fence_mean_ms\": %.4f, \"audio_fence_max_ms\": %.4f, \"peak_active_sounds\": %d, \"rejected\": %llu, \"culled\": %llu }"),
+					Index > 0 ? TEXT(",") : TEXT(""), GetScenarioName(Run.Scenario), Run.Rate, Run.bSkipped ? TEXT("true") : TEXT("false"), Run.Calls, NsPerCall, Run.GameThreadMs,
+					FenceMeanMs, Run.FenceMaxMs, Run.PeakActiveSounds, Run.Rejected, Run.Culled);
+
+				if (Run.bSkipped)
+				{
+					UE_LOG(LogTemp, Display, TEXT("[AudioBenchmark] %-36s %7d/s  skipped: sound did not load"), GetScenarioName(Run.Scenario), Run.Rate);
+					continue;
+				}
+
+				UE_LOG(LogTemp, Display, TEXT("[AudioBenchmark] %-36s %7d/s  %9.1f ns/call  fence %.3f/%.3f ms  peak %d"),
+					GetScenarioName(Run.Scenario), Run.Rate, NsPerCall, FenceMeanMs, Run.FenceMaxMs, Run.PeakActiveSounds);
+			}
+			Json += TEXT("\n  ]\n}\n");
+
+			const FString OutPath = FPaths::ProjectSavedDir() / TEXT("Profiling/AudioPlaySoundBenchmark.json");
+			FFileHelper::SaveStringToFile(Json, *OutPath);
+			UE_LOG(LogTemp, Display, TEXT("[AudioBenchmark] Results written to %s"), *OutPath);
+		}
+	};
+
+	FPlaySoundBenchmark& GetPlaySoundBenchmark()
+	{
+		static FPlaySoundBenchmark Benchmark;
+		return Benchmark;
+	}
+
+	/**
+	 * audio.BenchmarkPlaySound [Seconds] [Rate...] : runs every play path at each rate
+	 * (default 1000 10000 100000 requests/s) for Seconds each and writes JSON to
+	 * Saved/Profiling/AudioPlaySoundBenchmark.json. Needs a world; run headless with a null
+	 * audio device to measure the game-thread path without real output.
+	 */
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice AudioBenchmarkPlaySoundCommand(
+		TEXT("audio.BenchmarkPlaySound"),
+		TEXT("Drives the PlaySound paths at scaled request rates and writes per-call cost to Saved/Profiling."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			FPlaySoundBenchmark& Benchmark = GetPlaySoundBenchmark();
+			if (World == nullptr || Benchmark.IsRunning())
+			{
+				Ar.Log(TEXT("audio.BenchmarkPlaySound: no world, or a run is already in progress."));
+				return;
+			}
+
+			const double Seconds = Args.Num() > 0 ? FMath::Max(0.1, FCString::Atod(*Args[0])) : 2.0;
+
+			TArray<int32> Rates;
+			for (int32 Index = 1; Index < Args.Num(); ++Index)
+			{
+				Rates.Add(FMath::Max(1, FCString::Atoi(*Args[Index])));
+			}
+			if (Rates.Num() == 0)
+			{
+				Rates = { 1000, 10000, 100000 };
+			}
+
+			Benchmark.Start(World, Rates, Seconds);
+			Ar.Logf(TEXT("audio.BenchmarkPlaySound: %d runs of %.1f s started."), Rates.Num() * static_cast<int32>(EPlayBenchmarkScenario::Count), Seconds);
+		}));
 }
 
+#endif
+
 #pragma endregion
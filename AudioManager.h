@@ -4,17 +4,172 @@
 
 #include "DevelopmentUtility/DiagnosticSystem.h"
 #include "Kismet/GameplayStatics.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Containers/Ticker.h"
+#include "UObject/GCObject.h"
+#include "Commandlets/Commandlet.h"
+#include "Sound/QuartzQuantizationUtilities.h"
 #include "AudioManager.generated.h"
 
 #pragma region ForwardDeclaration
 
 class USoundBase;
 class USoundCue;
+class USoundWave;
+class UAudioComponent;
+class UQuartzClockHandle;
 
 #pragma endregion
 
 #pragma region AudioManager
 
+#pragma region Concurrency
+
+/** Mixer category a voice is counted against. */
+UENUM(BlueprintType)
+enum class EAudioCategory : uint8
+{
+	UI,
+	Utility,
+	Character,
+	Environment,
+	Music,
+
+	Count UMETA(Hidden)
+};
+
+/** Which voice gives way when a concurrency limit is reached. */
+UENUM(BlueprintType)
+enum class EVoiceStealPolicy : uint8
+{
+	// Stop the voice that started first
+	Oldest,
+	// Stop the voice with the lowest requested volume, or reject the new one if it is quieter
+	Quietest,
+	// Stop the voice with the lowest priority, or reject the new one if its priority is lower
+	LowestPriority
+};
+
+/** Voice limit for one category. */
+USTRUCT(BlueprintType)
+struct FAudioCategoryConcurrency
+{
+	GENERATED_BODY()
+
+	// Maximum voices alive in this category at once
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "1"))
+	int32 MaxVoices = 32;
+
+	// Policy used when a new voice would exceed MaxVoices or its sound's own limit
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EVoiceStealPolicy StealPolicy = EVoiceStealPolicy::Oldest;
+};
+
+#pragma endregion
+
+#pragma region VoicePool
+
+/**
+ * Fixed-capacity pool of reusable 2D audio components.
+ * Voices are created once and replayed instead of spawning a new active sound per request.
+ * Pooled voices count against the same category and per-sound limits as UAudioManager::PlaySound.
+ */
+USTRUCT()
+struct FAudioVoicePool
+{
+	GENERATED_BODY()
+
+public:
+	/** Maximum number of audio components the pool keeps alive */
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "1", UIMin = "1"))
+	int32 Capacity = 16;
+
+	/** Category whose concurrency limits the pooled voices count against */
+	UPROPERTY(EditAnywhere)
+	EAudioCategory Category = EAudioCategory::Utility;
+
+private:
+	/** Pooled voices, created lazily up to Capacity */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAudioComponent>> Voices;
+
+	/** World the pooled voices belong to; the pool is rebuilt when this changes */
+	TWeakObjectPtr<UWorld> PoolWorld;
+
+	/** FPlatformTime::Seconds when each voice in Voices was last started; the smallest is stolen first */
+	TArray<double> StartTimes;
+
+	/** Requests served by an idle pooled voice */
+	uint64 PoolHits = 0;
+
+	/** Requests that had to create a voice or steal a busy one */
+	uint64 PoolMisses = 0;
+
+public:
+	/** Plays Sound on a pooled voice. Returns the voice used, or nullptr if audio is unavailable or a limit rejected it. */
+	UAudioComponent* Play(UWorld* InWorld, USoundBase* Sound, float VolumeMultiplier = 1.f, float PitchMultiplier = 1.f, uint8 Priority = 128);
+
+	/**
+	 * Queues Sound on a pooled voice to start on a Quartz clock boundary, rendered sample-accurately
+	 * on the audio thread. The voice stays reserved until it has played.
+	 */
+	UAudioComponent* PlayQuantized(UWorld* InWorld, USoundBase* Sound, UQuartzClockHandle* Clock, const FQuartzQuantizationBoundary& Boundary);
+
+	/** Creates voices up to Capacity ahead of time so the first shots do not allocate. */
+	void Prewarm(UWorld* InWorld, USoundBase* Sound);
+
+	/** Changes the capacity, destroying any voices beyond the new limit. */
+	void SetCapacity(int32 InCapacity);
+
+	/** Stops and destroys every pooled voice. */
+	void Reset();
+
+	/** Resets the pool if its voices belong to World. Call on world cleanup so the pool never keeps a dead world reachable. */
+	void ReleaseWorld(const UWorld* World);
+
+	/** Reports pooled voices to the garbage collector when the pool is not owned by a UPROPERTY. */
+	void AddReferencedObjects(FReferenceCollector& Collector);
+
+	int32 GetNumVoices() const { return Voices.Num(); }
+	uint64 GetPoolHits() const { return PoolHits; }
+	uint64 GetPoolMisses() const { return PoolMisses; }
+
+private:
+	/** Returns the index of an idle voice, a new voice, or the voice started longest ago */
+	int32 AcquireVoice(UWorld* InWorld, USoundBase* Sound);
+	UAudioComponent* CreateVoice(UWorld* InWorld, USoundBase* Sound);
+};
+
+#pragma endregion
+
+#pragma region ThreadSafe
+
+/**
+ * Plain-data play request that may be built and queued from any thread.
+ * Objects are held weakly and resolved on the game thread when the queue drains;
+ * the caller only has to keep them alive while building the request.
+ */
+struct FAudioPlayRequest
+{
+	FWeakObjectPtr WorldContext;
+	FWeakObjectPtr Sound;
+	FVector Location = FVector::ZeroVector;
+	float VolumeMultiplier = 1.f;
+	EAudioCategory Category = EAudioCategory::Utility;
+	uint8 Priority = 128;
+	bool bIs2D = true;
+
+	/** FPlatformTime::Cycles64 when the request was made; stamped by EnqueuePlayRequest if left at zero */
+	uint64 RequestCycles = 0;
+};
+
+/** Number of requests the cross-thread queue can hold between two game-thread drains. */
+static constexpr uint32 AudioPlayRequestQueueCapacity = 2048;
+
+#pragma endregion
+
 UCLASS()
 class AGEOFREVERSE_API UAudioManager : public UObject
 {
@@ -27,6 +182,44 @@ public:
 
 #pragma endregion
 
+#pragma region Initialization
+
+public:
+    /**
+     * Loads this manager's sounds. Construction (including the CDO) does no asset work; this runs
+     * when called explicitly or on the first play. Safe to call repeatedly; ignored on the CDO.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Sound")
+    void InitializeAudio();
+
+    UFUNCTION(BlueprintPure, Category = "Sound")
+    bool IsAudioInitialized() const { return bAudioInitialized; }
+
+    /** Wall time spent in InitializeAudio for this instance */
+    double GetAudioInitSeconds() const { return AudioInitSeconds; }
+
+    /** Prints the initialization count and time per manager class */
+    static void DumpInitStats(FOutputDevice& Ar);
+
+protected:
+    /** Override to load assets; runs once per instance, on the game thread */
+    virtual void OnInitializeAudio() {}
+
+    /** Runs InitializeAudio on first use; call at the top of play entry points */
+    void EnsureAudioInitialized()
+    {
+        if (!bAudioInitialized)
+        {
+            InitializeAudio();
+        }
+    }
+
+private:
+    bool bAudioInitialized = false;
+    double AudioInitSeconds = 0.0;
+
+#pragma endregion
+
 #pragma region World
 
 protected:
@@ -54,530 +247,778 @@ public:
 #pragma region PlaySound
 
 public:
-	// Plays the specified sound in the game world using the given context.
-	static void PlaySound(UObject* WorldContextObject, USoundBase* Sound);	
+	/**
+	 * Plays the specified sound in the game world using the given context.
+	 * The voice counts against the per-sound and per-category limits; when a limit is reached a
+	 * voice is stolen according to the category's policy, or the request is rejected.
+	 * The voice comes from a per-category pool and is reused once it stops; do not keep it past the sound.
+	 * @return The voice that was started, or nullptr if the request was rejected.
+	 */
+	static UAudioComponent* PlaySound(UObject* WorldContextObject, USoundBase* Sound, EAudioCategory Category = EAudioCategory::UI, float VolumeMultiplier = 1.f, uint8 Priority = 128);
 
-	static void PlaySoundAtLocation(UObject* WorldContextObject, USoundBase* Sound, FVector Location);
+	static UAudioComponent* PlaySoundAtLocation(UObject* WorldContextObject, USoundBase* Sound, FVector Location, EAudioCategory Category = EAudioCategory::Environment, float VolumeMultiplier = 1.f, uint8 Priority = 128);
 
 #pragma endregion
 
-};
+#pragma region Concurrency
 
-#pragma endregion
+public:
+	/** Sets the voice limit and steal policy for a category. */
+	static void SetCategoryConcurrency(EAudioCategory Category, const FAudioCategoryConcurrency& InConcurrency);
 
-#pragma region UI
+	static FAudioCategoryConcurrency GetCategoryConcurrency(EAudioCategory Category);
 
-#pragma region Data
+	/** Limits how many instances of one sound may play at once. Zero restores the default limit. */
+	static void SetSoundConcurrencyLimit(const USoundBase* Sound, int32 MaxInstances);
 
-USTRUCT()
-struct FUIAudioData
-{
-	GENERATED_BODY()
+	/** Instance limit for sounds without an explicit one. */
+	static void SetDefaultSoundConcurrencyLimit(int32 MaxInstances);
 
-#pragma region DataEntry
+	/** Number of tracked voices still playing in a category. */
+	static int32 GetActiveVoiceCount(EAudioCategory Category);
 
-private:
-	// Sound to play when an action is confirmed or accepted
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> AcceptSound;
+	/** Total voices stopped to make room for new ones since startup. */
+	static uint64 GetStolenVoiceCount();
 
-	// Sound to play when navigating back in menus
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> BackSound;
+	/** Total requests rejected by a concurrency limit since startup. */
+	static uint64 GetRejectedVoiceCount();
 
-	// Sound to play when cancelling an action
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> CancelSound;
+#pragma endregion
 
-	// Sound to play when closing a window or panel
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> CloseSound;
+#pragma region Batching
 
-	// Sound to play when crafting items
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> CraftSound;
+public:
+	/**
+	 * When enabled, PlaySound and PlaySoundAtLocation append to a per-frame command buffer
+	 * instead of starting a voice immediately. The buffer is flushed once per frame and
+	 * identical requests (same sound, same location bucket) are merged into one voice.
+	 */
+	static void SetFrameBatchingEnabled(bool bEnabled);
 
-	// Sound to play when a disabled button is hovered over or pressed
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> DisableSound;
+	static bool IsFrameBatchingEnabled();
 
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> DragSound;
+	/** Edge length, in world units, of the grid cell used to decide that two positional requests are identical. */
+	static void SetFrameBatchBucketSize(float InBucketSize);
 
-	// Sound to play when dropping an item
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> DropSound;
+	/** Merged requests sum their volumes up to this cap. */
+	static void SetFrameBatchMaxMergedVolume(float InMaxVolume);
 
-	// Sound to play when equipping an item
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> EquipSound;
+	/**
+	 * Starts every buffered request now. Called automatically once per frame while batching is enabled.
+	 * @return Number of requests merged into another in this flush.
+	 */
+	static int32 FlushPlayCommands();
 
-	// Sound to play when unequipping an item
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> UnequipSound;
+	/** Requests merged away by the most recent flush. */
+	static int32 GetLastFlushMergedCount();
 
-	// Sound to play when an invalid or error action occurs
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> ErrorSound;
+	/** Requests merged away since startup. */
+	static uint64 GetTotalMergedCount();
 
-	// Sound to play when exiting or closing a UI element
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> ExitSound;
+#pragma endregion
 
-	// Sound to play when the button is hovered
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> HoverSound;
+#pragma region Culling
 
-	// Sound to play when opening a window or panel
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> OpenSound;
+public:
+	/** Enables the listener-distance cull applied before positional sounds reach the engine. */
+	static void SetDistanceCullingEnabled(bool bEnabled);
 
-	// Sound to play when picking up an item
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> PickupSound;
+	/** Edge length, in world units, of the uniform grid that buckets listeners. */
+	static void SetListenerGridCellSize(float InCellSize);
 
-	// Sound to play when pressing a button
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> PressSound;
+	/**
+	 * Returns true if Location is within Sound's attenuation radius of any listener.
+	 * Sounds without attenuation and looping sounds always count as audible.
+	 */
+	static bool IsLocationAudible(UObject* WorldContextObject, const USoundBase* Sound, const FVector& Location);
 
-	// Sound to play when purchasing an item
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> PurchaseSound;
+	/**
+	 * Batch cull: tests every location against every listener four lanes at a time.
+	 * @param OutAudibleIndices - Receives the indices into Locations that are within range.
+	 * @return Number of locations culled.
+	 */
+	static int32 CullInaudibleLocations(UObject* WorldContextObject, const USoundBase* Sound, TArrayView<const FVector> Locations, TArray<int32>& OutAudibleIndices);
 
-	// Sound to play for generic notifications or popups
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> NotificationSound;
+	/** Plays Sound at every audible location. Returns the number of requests passed on. */
+	static int32 PlaySoundAtLocations(UObject* WorldContextObject, USoundBase* Sound, TArrayView<const FVector> Locations, EAudioCategory Category = EAudioCategory::Environment, float VolumeMultiplier = 1.f, uint8 Priority = 128);
 
-	// Sound to play when scrolling lists or inventories
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> ScrollSound;
+	/** Positional requests dropped by the distance cull since startup. */
+	static uint64 GetCulledSoundCount();
 
-	// Sound to play when the button is selected or focused
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> SelectSound;
+#pragma endregion
 
-	// Sound to play when selling an item
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> SellSound;
+#pragma region Instrumentation
 
-	// Sound to play when decreasing a slider or value
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> SliderDecreaseSound;
+public:
+	/**
+	 * Prints the TopN sounds by play count, or by total request-to-start time when bByCost is set,
+	 * with cull/reject counts and a latency histogram.
+	 */
+	static void DumpSoundStats(FOutputDevice& Ar, int32 TopN = 20, bool bByCost = false);
 
-	// Sound to play when increasing a slider or value
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> SliderIncreaseSound;
+	/** Clears every per-sound counter and histogram. */
+	static void ResetSoundStats();
 
-	// Sound to play when switching tabs
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> SwitchSound;
+#pragma endregion
 
-	// Sound to play when upgrading or leveling up
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> UpgradeSound;
+#pragma region ThreadSafe
 
-#pragma endregion 
+public:
+	/**
+	 * Queues a play request from any thread without locking or allocating.
+	 * The game thread drains the queue once per frame through PlaySound / PlaySoundAtLocation.
+	 * @return false if the queue was full and the request was dropped.
+	 */
+	static bool EnqueuePlayRequest(const FAudioPlayRequest& Request);
 
-#pragma region Constructor
+	/** Starts every queued cross-thread request. Game thread only; runs automatically each frame. */
+	static int32 DrainPlayRequests();
 
-public:
-	FUIAudioData()
-	: AcceptSound(nullptr)
-	, BackSound(nullptr)
-	, CancelSound(nullptr)
-	, CloseSound(nullptr)
-	, CraftSound(nullptr)
-	, DisableSound(nullptr)
-	, DragSound(nullptr)
-	, DropSound(nullptr)
-	, EquipSound(nullptr)
-	, UnequipSound(nullptr)
-	, ErrorSound(nullptr)
-	, ExitSound(nullptr)
-	, HoverSound(nullptr)
-	, OpenSound(nullptr)
-	, PickupSound(nullptr)
-	, PressSound(nullptr)
-	, PurchaseSound(nullptr)
-	, NotificationSound(nullptr)
-	, ScrollSound(nullptr)
-	, SelectSound(nullptr)
-	, SellSound(nullptr)
-	, SliderDecreaseSound(nullptr)
-	, SliderIncreaseSound(nullptr)
-	, SwitchSound(nullptr)
-	, UpgradeSound(nullptr)
+	/** Requests dropped because the queue was full. */
+	static uint64 GetDroppedPlayRequestCount();
+
+	/** Largest number of requests drained in a single frame. */
+	static int32 GetPeakPlayRequestCount();
+
+#pragma endregion
+
+};
+
+#pragma endregion
+
+#pragma region SoundCache
+
+/**
+ * 64-bit FNV-1a of an asset path. Evaluated at compile time for path literals, and used both as
+ * the sound cache key and as the ID stored in the cooked sound manifest.
+ */
+constexpr uint64 MakeSoundId(const TCHAR* Path)
+{
+	uint64 Hash = 0xcbf29ce484222325ull;
+	for (; Path != nullptr && *Path != 0; ++Path)
 	{
-		LoadUIAudioAssets();
+		const uint32 Char = static_cast<uint32>(*Path);
+		Hash = (Hash ^ (Char & 0xff)) * 0x100000001b3ull;
+		Hash = (Hash ^ ((Char >> 8) & 0xff)) * 0x100000001b3ull;
 	}
+	return Hash;
+}
 
-#pragma endregion 
+/** Per-sound metadata recorded by the manifest commandlet */
+struct FSoundManifestEntry
+{
+	uint64 Id = 0;
+	FSoftObjectPath Path;
+	float Duration = 0.f;
+	uint8 NumChannels = 0;
+	EAudioCategory Category = EAudioCategory::Utility;
+};
 
-#pragma region Load
+/**
+ * Cooked ID -> asset table written by USoundManifestCommandlet. Paths are parsed once when the
+ * manifest loads; lookups are a binary search on the ID. Without a manifest (e.g. uncooked editor
+ * runs) callers fall back to their compile-time path literals.
+ */
+class AGEOFREVERSE_API FSoundManifest
+{
+public:
+	static constexpr uint32 Magic = 0x4E414D53; // "SMAN"
+	static constexpr uint32 Version = 1;
+
+	static FSoundManifest& Get();
+
+	/** Location the commandlet writes to and the runtime reads from */
+	static FString GetManifestPath();
+
+	const FSoundManifestEntry* Find(uint64 Id) const;
+	bool IsLoaded() const { return bLoaded; }
+	int32 Num() const { return Entries.Num(); }
+
+	/** Serializes Entries (sorted by ID) into the binary manifest format */
+	static void Write(TArray<FSoundManifestEntry>& InEntries, TArray<uint8>& OutBytes);
+
+private:
+	FSoundManifest();
+
+	TArray<FSoundManifestEntry> Entries;
+	bool bLoaded = false;
+};
 
-	void LoadSound(TObjectPtr<USoundBase>& SoundVar, const TCHAR* Path, const TCHAR* Name)
+/**
+ * Shared cache for every sound the audio data structs use, keyed by sound ID.
+ * Resident sounds are budgeted; once per frame the least recently used sounds that are neither
+ * pinned, playing nor in the small hot set of most recently used sounds are dropped so GC can
+ * reclaim them. A miss never loads inline: it starts an async load and the play that missed is dropped.
+ * Game thread only.
+ */
+class AGEOFREVERSE_API FSoundAssetCache : public FGCObject
+{
+public:
+	static FSoundAssetCache& Get();
+
+	/** Resolves Id through the sound manifest, or FallbackPath when the manifest does not know it */
+	static FSoftObjectPath ResolvePath(uint64 Id, const TCHAR* FallbackPath);
+
+	/** Slot for Id. Slots are never removed, so callers may keep the index (see FCachedSound). */
+	int32 FindOrAddSlot(uint64 Id);
+
+	/** Hot path: one index and a frame stamp. Null while the sound is not resident. */
+	FORCEINLINE USoundBase* GetSoundAt(int32 Slot, const TCHAR* FallbackPath)
 	{
-		USoundBase* LoadedSound = Cast<USoundBase>(StaticLoadObject(USoundBase::StaticClass(), nullptr, Path));
-		if (LoadedSound)
-		{
-			SoundVar = LoadedSound;
-			UE_LOG(LogTemp, Log, TEXT("%s loaded successfully using StaticLoadObject!"), Name);
-		}
-		else
+		FEntry& Entry = Entries[Slot];
+		if (Entry.Sound != nullptr)
 		{
-			UE_LOG(LogTemp, Error, TEXT("Failed to load %s using StaticLoadObject! Final Path: %s"), Name, Path);
+			++Hits;
+			Entry.LastUseFrame = GFrameCounter;
+			return Entry.Sound;
 		}
+		return HandleMiss(Slot, FallbackPath);
 	}
 
-
-	void LoadUIAudioAssets()
+	USoundBase* GetSound(uint64 Id, const TCHAR* FallbackPath)
 	{
-		LoadSound(AcceptSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Accept/SC_UI_Accept.SC_UI_Accept"), TEXT("AcceptSound"));
-		LoadSound(BackSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Back/SC_UI_Back.SC_UI_Back"), TEXT("BackSound"));
-		LoadSound(CancelSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Cancel/SC_UI_Cancel.SC_UI_Cancel"), TEXT("CancelSound"));
-		LoadSound(CraftSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Craft/SC_UI_Craft.SC_UI_Craft"), TEXT("CraftSound"));
-		LoadSound(CloseSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Close/SC_UI_Close.SC_UI_Close"), TEXT("CloseSound"));
-		LoadSound(DisableSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Disabled/SC_UI_Disabled.SC_UI_Disabled"), TEXT("DisableSound"));
-		LoadSound(DragSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Drag/SC_UI_Drag.SC_UI_Drag"), TEXT("DragSound")); // if needed, else remove
-		LoadSound(DropSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Drop/SC_UI_Drop.SC_UI_Drop"), TEXT("DropSound"));
-		LoadSound(EquipSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Equip/SC_UI_Equip.SC_UI_Equip"), TEXT("EquipSound"));
-		LoadSound(ErrorSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Error/SC_UI_Error.SC_UI_Error"), TEXT("ErrorSound"));
-		LoadSound(HoverSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Hovered/SC_UI_Hovered.SC_UI_Hovered"), TEXT("HoverSound"));
-		LoadSound(OpenSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Open/SC_UI_Open.SC_UI_Open"), TEXT("OpenSound"));
-		LoadSound(PickupSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Pickup/SC_UI_Pickup.SC_UI_Pickup"), TEXT("PickupSound"));
-		LoadSound(PressSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Pressed/SC_UI_Pressed.SC_UI_Pressed"), TEXT("PressSound"));
-		LoadSound(PurchaseSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Purchase/SC_UI_Purchase.SC_UI_Purchase"), TEXT("PurchaseSound"));
-		LoadSound(ScrollSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Scroll/SC_UI_Scroll.SC_UI_Scroll"), TEXT("ScrollSound"));
-		LoadSound(SellSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Sell/SC_UI_Sell.SC_UI_Sell"), TEXT("SellSound"));
-		LoadSound(SelectSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Select/SC_UI_Select.SC_UI_Select"), TEXT("SelectSound"));
-		LoadSound(SliderDecreaseSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Slider/Decrease/SC_UI_SliderDecrease.SC_UI_SliderDecrease"), TEXT("SliderDecreaseSound"));
-		LoadSound(SliderIncreaseSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Slider/Increase/SC_UI_SliderIncrease.SC_UI_SliderIncrease"), TEXT("SliderIncreaseSound"));
-		LoadSound(SwitchSound, TEXT("/Game/Blueprint/Auido/UI/Assets/TabSwitch/SC_UI_TabSwitch.SC_UI_TabSwitch"), TEXT("SwitchSound"));
-		LoadSound(UnequipSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Unequip/SC_UI_Unequip.SC_UI_Unequip"), TEXT("UnequipSound"));
-		LoadSound(UpgradeSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Upgrade/SC_UI_Upgrade.SC_UI_Upgrade"), TEXT("UpgradeSound"));
-		LoadSound(ExitSound, TEXT("/Game/Blueprint/Auido/UI/Assets/Exit/SC_UI_Exit.SC_UI_Exit"), TEXT("ExitSound"));
+		return GetSoundAt(FindOrAddSlot(Id), FallbackPath);
 	}
 
-#pragma endregion
+	/** Starts an async load of Id unless it is resident or already streaming */
+	void Prefetch(uint64 Id, const TCHAR* FallbackPath);
 
-#pragma region Accessors
+	/** Registers a sound that was loaded elsewhere, e.g. by a bank's own async request */
+	void AddSound(uint64 Id, USoundBase* Sound);
+
+	/** Pinned sounds are never evicted; calls nest and may come before the sound is resident */
+	void Pin(uint64 Id);
+	void Unpin(uint64 Id);
+
+	void SetBudgetBytes(int64 InBudgetBytes);
+	int64 GetBudgetBytes() const { return BudgetBytes; }
+
+	/** Number of most recently used sounds the budget pass never evicts */
+	void SetHotSetSize(int32 InHotSetSize) { HotSetSize = FMath::Max(0, InHotSetSize); }
+	int64 GetResidentBytes() const { return ResidentBytes; }
 
-	USoundBase* GetHoveredSound() const
+	uint64 GetHitCount() const { return Hits; }
+	uint64 GetMissCount() const { return Misses; }
+	uint64 GetEvictionCount() const { return Evictions; }
+
+	//~ FGCObject
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FSoundAssetCache"); }
+
+private:
+	FSoundAssetCache();
+	virtual ~FSoundAssetCache();
+
+	struct FEntry
 	{
-		if (HoverSound == nullptr)
-		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(HoverSound);
-#else
-			LOG_FATAL_USER();
-#endif
-		}
-		return HoverSound;
-	}
+		uint64 Id = 0;
+		TObjectPtr<USoundBase> Sound = nullptr;
+		int64 Bytes = 0;
+		int32 PinCount = 0;
+
+		/** Stamped on every hit; folded into LastUseTime by the per-frame pass */
+		uint64 LastUseFrame = 0;
+		double LastUseTime = 0.0;
+
+		bool bLoading = false;
+		TSharedPtr<FStreamableHandle> LoadHandle;
+	};
+
+	TArray<FEntry> Entries;
+	TMap<uint64, int32> SlotsById;
+	FTSTicker::FDelegateHandle TickHandle;
+	uint64 LastTickFrame = 0;
+	int64 BudgetBytes = 32 * 1024 * 1024;
+	int32 HotSetSize = 8;
+	int64 ResidentBytes = 0;
+	uint64 Hits = 0;
+	uint64 Misses = 0;
+	uint64 Evictions = 0;
+
+	USoundBase* HandleMiss(int32 Slot, const TCHAR* FallbackPath);
+	void StartLoad(int32 Slot, const FSoftObjectPath& Path);
+	void SetSlotSound(int32 Slot, USoundBase* Sound);
+	bool Tick(float DeltaTime);
+	void EnforceBudget();
+};
 
-	USoundBase* GetPressedSound() const
+/**
+ * A sound referenced by ID and resolved through FSoundAssetCache; holds no reference itself.
+ * The path literal is only read when no cooked manifest entry exists. The cache slot is looked up
+ * once and kept, so Get() is a direct index afterwards.
+ */
+struct FCachedSound
+{
+	constexpr FCachedSound() = default;
+
+	constexpr explicit FCachedSound(const TCHAR* InPath)
+		: Id(MakeSoundId(InPath))
+		, DevPath(InPath)
 	{
-		if (PressSound == nullptr)
-		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(PressSound);
-#else
-			LOG_FATAL_USER();
-#endif
-		}
-		return PressSound;
 	}
 
-	USoundBase* GetSelectSound() const
+	/** Null when no path is set or the sound is not resident yet; a miss starts an async load */
+	USoundBase* Get() const
 	{
-		if (SelectSound == nullptr)
-		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(SelectSound);
-#else
-			LOG_FATAL_USER();
-#endif
-		}
-		return SelectSound;
+		return DevPath == nullptr ? nullptr : FSoundAssetCache::Get().GetSoundAt(GetSlot(), DevPath);
 	}
 
-	USoundBase* GetExitSound() const
+	/** Starts streaming the sound without waiting for it */
+	void Prefetch() const
 	{
-		if (ExitSound == nullptr)
+		if (DevPath != nullptr)
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(ExitSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			FSoundAssetCache::Get().Prefetch(Id, DevPath);
 		}
-		return ExitSound;
 	}
 
-	USoundBase* GetSliderIncreaseSound() const
+	/** Keeps the sound resident until the matching Unpin */
+	void Pin() const
 	{
-		if (SliderIncreaseSound == nullptr)
+		if (DevPath != nullptr)
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(SliderIncreaseSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			FSoundAssetCache::Get().Pin(Id);
 		}
-		return SliderIncreaseSound;
 	}
 
-	USoundBase* GetSliderDecreaseSound() const
+	void Unpin() const
 	{
-		if (SliderDecreaseSound == nullptr)
+		if (DevPath != nullptr)
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(SliderDecreaseSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			FSoundAssetCache::Get().Unpin(Id);
 		}
-		return SliderDecreaseSound;
 	}
 
-	USoundBase* GetErrorSound() const
+	bool IsSet() const { return DevPath != nullptr; }
+	uint64 GetId() const { return Id; }
+	const TCHAR* GetDevPath() const { return DevPath; }
+	FSoftObjectPath ResolvePath() const { return FSoundAssetCache::ResolvePath(Id, DevPath); }
+
+private:
+	uint64 Id = 0;
+	const TCHAR* DevPath = nullptr;
+	mutable int32 Slot = INDEX_NONE;
+
+	int32 GetSlot() const
 	{
-		if (ErrorSound == nullptr)
+		if (Slot == INDEX_NONE)
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(ErrorSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			Slot = FSoundAssetCache::Get().FindOrAddSlot(Id);
 		}
-		return ErrorSound;
+		return Slot;
 	}
+};
+
+#pragma endregion
+
+#pragma region Manifest
+
+/**
+ * Cook step: loads every sound the audio data structs reference, fails on any path that does not
+ * resolve, and writes the binary sound manifest.
+ * Run before cooking with -run=SoundManifest; the output must be staged as a non-asset file.
+ */
+UCLASS()
+class AGEOFREVERSE_API USoundManifestCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USoundManifestCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
+
+#pragma endregion
+
+#pragma region UI
+
+#pragma region Data
+
+/** Streaming state of the UI sound assets. */
+UENUM()
+enum class EUIAudioLoadState : uint8
+{
+	Unloaded,
+	Loading,
+	Loaded,
+	Failed
+};
+
+/** What a Play call does while the UI sounds are still streaming in. */
+UENUM()
+enum class EUIAudioPendingPolicy : uint8
+{
+	// Remember the request and play it once the load completes
+	Queue,
+	// Drop the request silently
+	Skip
+};
+
+/** Every UI sound, used as a direct index into FUIAudioData's sound table. */
+UENUM(BlueprintType)
+enum class EUISound : uint8
+{
+	Accept,
+	Back,
+	Cancel,
+	Close,
+	Craft,
+	Disabled,
+	Drag,
+	Drop,
+	Equip,
+	Unequip,
+	Error,
+	Exit,
+	Hovered,
+	Open,
+	Pickup,
+	Pressed,
+	Purchase,
+	Notification,
+	Scroll,
+	Select,
+	Sell,
+	SliderDecrease,
+	SliderIncrease,
+	TabSwitch,
+	Upgrade,
+
+	Count UMETA(Hidden)
+};
+
+/** Static description of a UI sound. */
+struct FUISoundInfo
+{
+	// Asset path, or nullptr if the sound has no asset yet
+	const TCHAR* Path;
+
+	// Name used in logs
+	const TCHAR* Name;
+
+	// Default voice priority (0 = lowest, 255 = highest)
+	uint8 Priority;
+};
+
+/** Compile-time metadata for every UI sound, ordered to match EUISound. */
+inline constexpr FUISoundInfo GUISoundTable[] =
+{
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Accept/SC_UI_Accept.SC_UI_Accept"),                                         TEXT("AcceptSound"),         160 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Back/SC_UI_Back.SC_UI_Back"),                                               TEXT("BackSound"),           128 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Cancel/SC_UI_Cancel.SC_UI_Cancel"),                                         TEXT("CancelSound"),         160 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Close/SC_UI_Close.SC_UI_Close"),                                            TEXT("CloseSound"),          128 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Craft/SC_UI_Craft.SC_UI_Craft"),                                            TEXT("CraftSound"),          160 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Disabled/SC_UI_Disabled.SC_UI_Disabled"),                                   TEXT("DisableSound"),        96  },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Drag/SC_UI_Drag.SC_UI_Drag"),                                               TEXT("DragSound"),           64  },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Drop/SC_UI_Drop.SC_UI_Drop"),                                               TEXT("DropSound"),           128 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Equip/SC_UI_Equip.SC_UI_Equip"),                                            TEXT("EquipSound"),          160 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Unequip/SC_UI_Unequip.SC_UI_Unequip"),                                      TEXT("UnequipSound"),        160 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Error/SC_UI_Error.SC_UI_Error"),                                            TEXT("ErrorSound"),          224 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Exit/SC_UI_Exit.SC_UI_Exit"),                                               TEXT("ExitSound"),           128 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Hovered/SC_UI_Hovered.SC_UI_Hovered"),                                      TEXT("HoverSound"),          32  },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Open/SC_UI_Open.SC_UI_Open"),                                               TEXT("OpenSound"),           128 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Pickup/SC_UI_Pickup.SC_UI_Pickup"),                                         TEXT("PickupSound"),         160 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Pressed/SC_UI_Pressed.SC_UI_Pressed"),                                      TEXT("PressSound"),          128 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Purchase/SC_UI_Purchase.SC_UI_Purchase"),                                   TEXT("PurchaseSound"),       192 },
+	{ nullptr,                                                                                                          TEXT("NotificationSound"),   224 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Scroll/SC_UI_Scroll.SC_UI_Scroll"),                                         TEXT("ScrollSound"),         32  },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Select/SC_UI_Select.SC_UI_Select"),                                         TEXT("SelectSound"),         96  },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Sell/SC_UI_Sell.SC_UI_Sell"),                                               TEXT("SellSound"),           192 },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Slider/Decrease/SC_UI_SliderDecrease.SC_UI_SliderDecrease"),                TEXT("SliderDecreaseSound"), 48  },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Slider/Increase/SC_UI_SliderIncrease.SC_UI_SliderIncrease"),                TEXT("SliderIncreaseSound"), 48  },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/TabSwitch/SC_UI_TabSwitch.SC_UI_TabSwitch"),                                TEXT("SwitchSound"),         96  },
+	{ TEXT("/Game/Blueprint/Auido/UI/Assets/Upgrade/SC_UI_Upgrade.SC_UI_Upgrade"),                                      TEXT("UpgradeSound"),        192 },
+};
+
+static_assert(UE_ARRAY_COUNT(GUISoundTable) == static_cast<int32>(EUISound::Count), "GUISoundTable must have one entry per EUISound");
+
+/** Returns the compile-time metadata for a UI sound. */
+constexpr const FUISoundInfo& GetUISoundInfo(EUISound Sound)
+{
+	return GUISoundTable[static_cast<int32>(Sound)];
+}
+
+DECLARE_MULTICAST_DELEGATE(FOnUIAudioLoaded);
+
+USTRUCT()
+struct FUIAudioData
+{
+	GENERATED_BODY()
+
+#pragma region DataEntry
+
+public:
+	static constexpr int32 NumSounds = static_cast<int32>(EUISound::Count);
+
+private:
+	// UI sounds, indexed by EUISound, resolved through the shared sound cache. Paths come from GUISoundTable.
+	FCachedSound Sounds[static_cast<int32>(EUISound::Count)];
+
+#pragma endregion 
+
+#pragma region Constructor
 
-	USoundBase* GetAcceptSound() const
+public:
+	FUIAudioData()
+	: Sounds()
+	, LoadState(EUIAudioLoadState::Unloaded)
+	, PendingPlayPolicy(EUIAudioPendingPolicy::Queue)
 	{
-		if (AcceptSound == nullptr)
+		for (int32 Index = 0; Index < NumSounds; ++Index)
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(AcceptSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			if (GUISoundTable[Index].Path != nullptr)
+			{
+				Sounds[Index] = FCachedSound(GUISoundTable[Index].Path);
+			}
 		}
-		return AcceptSound;
 	}
 
-	USoundBase* GetDisabledSound() const
+	// The load delegate is bound to this address, so the bank is shared rather than copied.
+	FUIAudioData(const FUIAudioData&) = delete;
+	FUIAudioData& operator=(const FUIAudioData&) = delete;
+
+	~FUIAudioData()
 	{
-		if (DisableSound == nullptr)
-		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(DisableSound);
-#else
-			LOG_FATAL_USER();
-#endif
-		}
-		return DisableSound;
+		CancelUIAudioLoad();
 	}
 
-	USoundBase* GetNotificationSound() const
+	/**
+	 * Process-wide UI sound bank shared by every UUIAudioManager and the UIAudio helpers.
+	 * Held weakly here, so it is created by the first owner and freed with the last one.
+	 */
+	static TSharedRef<FUIAudioData> AcquireShared()
 	{
-		if (NotificationSound == nullptr)
+		TWeakPtr<FUIAudioData>& SharedBank = GetSharedBank();
+
+		TSharedPtr<FUIAudioData> Bank = SharedBank.Pin();
+		if (!Bank.IsValid())
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(NotificationSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			Bank = MakeShared<FUIAudioData>();
+			SharedBank = Bank;
 		}
-		return NotificationSound;
+		return Bank.ToSharedRef();
 	}
 
-	USoundBase* GetCancelSound() const
+	/** The shared bank if an owner currently holds it. Never creates one. */
+	static TSharedPtr<FUIAudioData> FindShared()
 	{
-		if (CancelSound == nullptr)
-		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(CancelSound);
-#else
-			LOG_FATAL_USER();
-#endif
-		}
-		return CancelSound;
+		return GetSharedBank().Pin();
 	}
 
-	USoundBase* GetBackSound() const
+private:
+	static TWeakPtr<FUIAudioData>& GetSharedBank()
 	{
-		if (BackSound == nullptr)
-		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(BackSound);
-#else
-			LOG_FATAL_USER();
-#endif
-		}
-		return BackSound;
+		static TWeakPtr<FUIAudioData> SharedBank;
+		return SharedBank;
 	}
 
-	USoundBase* GetOpenSound() const
+#pragma endregion 
+
+#pragma region Load
+
+public:
+	/** Upper bound on requests remembered while loading. */
+	static constexpr int32 MaxPendingUIPlays = 8;
+
+private:
+	/** A Play request received before the UI sounds finished loading. */
+	struct FUIPendingPlay
 	{
-		if (OpenSound == nullptr)
-		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(OpenSound);
-#else
-			LOG_FATAL_USER();
-#endif
-		}
-		return OpenSound;
-	}
+		TWeakObjectPtr<UWorld> World;
+		EUISound Sound;
+	};
+
+	/** Current streaming state of the UI sound assets */
+	EUIAudioLoadState LoadState;
+
+	/** How Play requests are handled while the assets are still streaming in; set through SetPendingPlayPolicy */
+	EUIAudioPendingPolicy PendingPlayPolicy;
+
+	/** In-flight streaming request; released once its sounds are handed to the sound cache */
+	TSharedPtr<FStreamableHandle> LoadHandle;
+
+	/** Play requests received while loading, replayed once the assets are resident */
+	TArray<FUIPendingPlay, TInlineAllocator<MaxPendingUIPlays>> PendingPlays;
+
+	/** Broadcast on the game thread when the async load finishes */
+	FOnUIAudioLoaded OnUIAudioLoaded;
 
-	USoundBase* GetCloseSound() const
+	void HandleUIAudioAssetsLoaded()
 	{
-		if (CloseSound == nullptr)
+		LoadState = (LoadHandle.IsValid() && LoadHandle->HasLoadCompleted()) ? EUIAudioLoadState::Loaded : EUIAudioLoadState::Failed;
+
+		// Hand the streamed sounds to the shared cache, where the bank's pins keep them resident.
+		FSoundAssetCache& Cache = FSoundAssetCache::Get();
+		for (const FCachedSound& Sound : Sounds)
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(CloseSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			if (Sound.IsSet())
+			{
+				Cache.AddSound(Sound.GetId(), Cast<USoundBase>(Sound.ResolvePath().ResolveObject()));
+			}
 		}
-		return CloseSound;
-	}
-
-	USoundBase* GetTabSwitchSound() const
-	{
-		if (SwitchSound == nullptr)
+		if (LoadHandle.IsValid())
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(SwitchSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			LoadHandle->ReleaseHandle();
 		}
-		return SwitchSound;
-	}
 
-	USoundBase* GetScrollSound() const
-	{
-		if (ScrollSound == nullptr)
-		{
 #if DEV_DEBUG_MODE
-			LOG_INVALID(ScrollSound);
-#else
-			LOG_FATAL_USER();
+		if (LoadState == EUIAudioLoadState::Failed)
+		{
+			LOG_ERROR("UI audio assets failed to stream in.");
+		}
+		else
+		{
+			LOG_INFO("UI audio assets streamed in successfully.");
+		}
 #endif
+
+		// Replay whatever was requested while the assets were in flight.
+		for (const FUIPendingPlay& Pending : PendingPlays)
+		{
+			UWorld* World = Pending.World.Get();
+			USoundBase* Sound = GetSound(Pending.Sound);
+			if (World && Sound)
+			{
+				UAudioManager::PlaySound(World, Sound, EAudioCategory::UI, 1.f, GetUISoundInfo(Pending.Sound).Priority);
+			}
 		}
-		return ScrollSound;
+		PendingPlays.Reset();
+
+		OnUIAudioLoaded.Broadcast();
 	}
 
-	USoundBase* GetEquipSound() const
+public:
+	/**
+	 * Starts streaming every UI sound in the background. Safe to call repeatedly;
+	 * only the first call issues a request.
+	 */
+	void LoadUIAudioAssets()
 	{
-		if (EquipSound == nullptr)
+		if (LoadState != EUIAudioLoadState::Unloaded)
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(EquipSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			return;
 		}
-		return EquipSound;
-	}
 
-	USoundBase* GetUnequipSound() const
-	{
-		if (UnequipSound == nullptr)
+		// Not pinned: frequent hover and click sounds stay in the cache's hot set, rare ones may be evicted.
+		TArray<FSoftObjectPath> Paths;
+		Paths.Reserve(NumSounds);
+		for (const FCachedSound& Sound : Sounds)
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(UnequipSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			if (Sound.IsSet())
+			{
+				Paths.Add(Sound.ResolvePath());
+			}
 		}
-		return UnequipSound;
-	}
 
-	USoundBase* GetDropSound() const
-	{
-		if (DropSound == nullptr)
+		LoadState = EUIAudioLoadState::Loading;
+		LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			MoveTemp(Paths),
+			FStreamableDelegate::CreateRaw(this, &FUIAudioData::HandleUIAudioAssetsLoaded),
+			FStreamableManager::AsyncLoadHighPriority);
+
+		// RequestAsyncLoad returns null when nothing needed loading and the delegate has already fired.
+		if (!LoadHandle.IsValid() && LoadState == EUIAudioLoadState::Loading)
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(DropSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			HandleUIAudioAssetsLoaded();
 		}
-		return DropSound;
 	}
 
-	USoundBase* GetPickupSound() const
+	/** Cancels an in-flight load. Call before the owner is destroyed. */
+	void CancelUIAudioLoad()
 	{
-		if (PickupSound == nullptr)
+		if (LoadHandle.IsValid() && LoadHandle->IsLoadingInProgress())
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(PickupSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			LoadHandle->CancelHandle();
 		}
-		return PickupSound;
+		PendingPlays.Reset();
 	}
 
-	USoundBase* GetPurchaseSound() const
+	EUIAudioLoadState GetLoadState() const { return LoadState; }
+	bool IsLoaded() const { return LoadState == EUIAudioLoadState::Loaded; }
+
+	void SetPendingPlayPolicy(EUIAudioPendingPolicy InPolicy) { PendingPlayPolicy = InPolicy; }
+
+	/** Fires once the UI sounds are resident. Bind before calling LoadUIAudioAssets. */
+	FOnUIAudioLoaded& OnLoaded() { return OnUIAudioLoaded; }
+
+	/**
+	 * Handles a Play request that arrives before the assets are resident.
+	 * Queues or skips it according to PendingPlayPolicy, kicking off the load if needed.
+	 * @return true if the request was consumed and the caller should not play it now.
+	 */
+	bool DeferWhileLoading(UWorld* InWorldContext, EUISound Sound)
 	{
-		if (PurchaseSound == nullptr)
+		if (LoadState == EUIAudioLoadState::Loaded || LoadState == EUIAudioLoadState::Failed)
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(PurchaseSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			return false;
 		}
-		return PurchaseSound;
-	}
 
-	USoundBase* GetSellSound() const
-	{
-		if (SellSound == nullptr)
+		LoadUIAudioAssets();
+
+		// The load may have completed synchronously if everything was already resident.
+		if (LoadState == EUIAudioLoadState::Loaded)
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(SellSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			return false;
 		}
-		return SellSound;
-	}
 
-	USoundBase* GetCraftSound() const
-	{
-		if (CraftSound == nullptr)
+		if (PendingPlayPolicy == EUIAudioPendingPolicy::Queue && PendingPlays.Num() < MaxPendingUIPlays)
 		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(CraftSound);
-#else
-			LOG_FATAL_USER();
-#endif
+			PendingPlays.Add({ InWorldContext, Sound });
 		}
-		return CraftSound;
+
+		return true;
 	}
 
-	USoundBase* GetUpgradeSound() const
+#pragma endregion
+
+#pragma region Accessors
+
+	/** Bounds-checked lookup into the sound table, resolved through the sound cache. No logging on this path. */
+	FORCEINLINE USoundBase* GetSound(EUISound Sound) const
 	{
-		if (UpgradeSound == nullptr)
-		{
-#if DEV_DEBUG_MODE
-			LOG_INVALID(UpgradeSound);
-#else
-			LOG_FATAL_USER();
-#endif
-		}
-		return UpgradeSound;
+		const uint32 Index = static_cast<uint32>(Sound);
+		return Index < static_cast<uint32>(NumSounds) ? Sounds[Index].Get() : nullptr;
 	}
 
+	USoundBase* GetHoveredSound() const          { return GetSound(EUISound::Hovered); }
+	USoundBase* GetPressedSound() const          { return GetSound(EUISound::Pressed); }
+	USoundBase* GetSelectSound() const           { return GetSound(EUISound::Select); }
+	USoundBase* GetExitSound() const             { return GetSound(EUISound::Exit); }
+	USoundBase* GetSliderIncreaseSound() const   { return GetSound(EUISound::SliderIncrease); }
+	USoundBase* GetSliderDecreaseSound() const   { return GetSound(EUISound::SliderDecrease); }
+	USoundBase* GetErrorSound() const            { return GetSound(EUISound::Error); }
+	USoundBase* GetAcceptSound() const           { return GetSound(EUISound::Accept); }
+	USoundBase* GetDisabledSound() const         { return GetSound(EUISound::Disabled); }
+	USoundBase* GetNotificationSound() const     { return GetSound(EUISound::Notification); }
+	USoundBase* GetCancelSound() const           { return GetSound(EUISound::Cancel); }
+	USoundBase* GetBackSound() const             { return GetSound(EUISound::Back); }
+	USoundBase* GetOpenSound() const             { return GetSound(EUISound::Open); }
+	USoundBase* GetCloseSound() const            { return GetSound(EUISound::Close); }
+	USoundBase* GetTabSwitchSound() const        { return GetSound(EUISound::TabSwitch); }
+	USoundBase* GetScrollSound() const           { return GetSound(EUISound::Scroll); }
+	USoundBase* GetEquipSound() const            { return GetSound(EUISound::Equip); }
+	USoundBase* GetUnequipSound() const          { return GetSound(EUISound::Unequip); }
+	USoundBase* GetDropSound() const             { return GetSound(EUISound::Drop); }
+	USoundBase* GetPickupSound() const           { return GetSound(EUISound::Pickup); }
+	USoundBase* GetPurchaseSound() const         { return GetSound(EUISound::Purchase); }
+	USoundBase* GetSellSound() const             { return GetSound(EUISound::Sell); }
+	USoundBase* GetCraftSound() const            { return GetSound(EUISound::Craft); }
+	USoundBase* GetUpgradeSound() const          { return GetSound(EUISound::Upgrade); }
+
 #pragma endregion
 
 };
 
+template<>
+struct TStructOpsTypeTraits<FUIAudioData> : public TStructOpsTypeTraitsBase2<FUIAudioData>
+{
+	enum
+	{
+		WithCopy = false,
+	};
+};
+
 #pragma endregion
 
 #pragma region UIAudioManager
@@ -593,20 +1034,38 @@ public:
 	/** Default constructor */
 	UUIAudioManager(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	/** Drops this instance's reference to the shared UI sound bank */
+	virtual void BeginDestroy() override;
+
 #pragma endregion
 
 #pragma region UIAudioData
 
 private:
-    /** UI audio data container holding various sound assets */
-    UPROPERTY(VisibleAnywhere)
-    FUIAudioData UIAudioData;
+    /** Shared, process-wide UI sound bank; acquired on first use so the CDO holds none */
+    TSharedPtr<FUIAudioData> UIAudioBank;
+
+    FUIAudioData& GetUIAudioBank();
+
+protected:
+    /** Starts streaming the shared UI bank; later managers find it already loading or loaded */
+    virtual void OnInitializeAudio() override;
 
 public:
-    /** Returns the UI audio data container */
-    FUIAudioData GetUIAudioData() const
+    /** Read-only view of the shared UI sound bank; copies nothing */
+    const FUIAudioData& GetUIAudioData() const;
+
+    /** Returns true once every UI sound has streamed in */
+    UFUNCTION(BlueprintPure, Category = "Sound")
+    bool IsUIAudioLoaded() const
     {
-        return UIAudioData;
+        return UIAudioBank.IsValid() && UIAudioBank->IsLoaded();
+    }
+
+    /** Fires once the UI sounds are resident; shared by every UI manager */
+    FOnUIAudioLoaded& OnUIAudioLoaded()
+    {
+        return GetUIAudioBank().OnLoaded();
     }
 
 #pragma endregion
@@ -614,6 +1073,13 @@ public:
 #pragma region Play
 
 public:
+    /**
+     * Plays any UI sound by enum. This is the fast path: one bounds-checked table
+     * index and no logging unless the request fails.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Sound")
+    void PlayUISound(UWorld* InWorldContext, EUISound Sound);
+
     /** Play sound for UI hover event */
     UFUNCTION(BlueprintCallable, Category = "Sound")
     void PlayHoveredSound(UWorld* InWorldContext);
@@ -659,8 +1125,12 @@ namespace UIAudio
 
 #pragma region Data
 
-    /** Global UI audio data container */
-    inline FUIAudioData UIAudioData;
+    /**
+     * The shared UI sound bank, created on first use so the helpers work without a UUIAudioManager.
+     * The helpers' own reference is released at engine pre-exit, never during static destruction;
+     * after that this returns the bank only while a UUIAudioManager still holds it.
+     */
+    AGEOFREVERSE_API TSharedPtr<FUIAudioData> GetUIAudioData();
 
 #pragma endregion
 
@@ -668,19 +1138,35 @@ namespace UIAudio
 
     /**
      * Plays the given UI sound with context and validity checks.
+     * Requests made while the global UI sounds are streaming in are deferred.
      * @param InWorldContext - The world context for playing sound.
-     * @param Sound - The sound asset to play.
+     * @param Sound - The UI sound to play.
     */
-    inline void PlayUISound(UWorld* InWorldContext, USoundBase* Sound)
+    inline void PlayUISound(UWorld* InWorldContext, EUISound Sound)
     {
-        if (!InWorldContext || !Sound)
+        const TSharedPtr<FUIAudioData> UIAudioData = GetUIAudioData();
+        if (!UIAudioData.IsValid())
+        {
+            #if DEV_DEBUG_MODE
+                LOG_ERROR("PlayUISound: the UI sound bank was released at shutdown");
+            #endif
+            return;
+        }
+
+        if (UIAudioData->DeferWhileLoading(InWorldContext, Sound))
+        {
+            return;
+        }
+
+        USoundBase* SoundAsset = UIAudioData->GetSound(Sound);
+        if (!InWorldContext || !SoundAsset)
         {
             #if DEV_DEBUG_MODE
                 if (!InWorldContext)
                 {
                     LOG_ERROR("PlayUISound: InWorldContext is nullptr");
                 }
-                if (!Sound)
+                if (!SoundAsset)
                 {
                     LOG_ERROR("PlayUISound: Sound is nullptr");
                 }
@@ -691,41 +1177,38 @@ namespace UIAudio
             return;
         }
 
-        #if DEV_DEBUG_MODE
-            LOG_INFO("PlayUISound: Playing UI sound");
-        #endif
-
-        UGameplayStatics::PlaySound2D(InWorldContext, Sound);
+        // Same path as UUIAudioManager::PlayUISound: concurrency limits, batching and stats apply.
+        UAudioManager::PlaySound(InWorldContext, SoundAsset, EAudioCategory::UI, 1.f, GetUISoundInfo(Sound).Priority);
     }
 
 #pragma endregion
 
 #pragma region Play
 
-    inline void PlayHoveredSound(UWorld* InWorldContext)         { PlayUISound(InWorldContext, UIAudioData.GetHoveredSound()); }
-    inline void PlayPressedSound(UWorld* InWorldContext)         { PlayUISound(InWorldContext, UIAudioData.GetPressedSound()); }
-    inline void PlaySelectSound(UWorld* InWorldContext)          { PlayUISound(InWorldContext, UIAudioData.GetSelectSound()); }
-    inline void PlayExitSound(UWorld* InWorldContext)            { PlayUISound(InWorldContext, UIAudioData.GetExitSound()); }
-    inline void PlaySliderIncreaseSound(UWorld* InWorldContext)  { PlayUISound(InWorldContext, UIAudioData.GetSliderIncreaseSound()); }
-    inline void PlaySliderDecreaseSound(UWorld* InWorldContext)  { PlayUISound(InWorldContext, UIAudioData.GetSliderDecreaseSound()); }
-    inline void PlayErrorSound(UWorld* InWorldContext)           { PlayUISound(InWorldContext, UIAudioData.GetErrorSound()); }
-    inline void PlayAcceptSound(UWorld* InWorldContext)          { PlayUISound(InWorldContext, UIAudioData.GetAcceptSound()); }
-    inline void PlayDisabledSound(UWorld* InWorldContext)        { PlayUISound(InWorldContext, UIAudioData.GetDisabledSound()); }
-    inline void PlayNotificationSound(UWorld* InWorldContext)    { PlayUISound(InWorldContext, UIAudioData.GetNotificationSound()); }
-    inline void PlayCancelSound(UWorld* InWorldContext)          { PlayUISound(InWorldContext, UIAudioData.GetCancelSound()); }
-    inline void PlayBackSound(UWorld* InWorldContext)            { PlayUISound(InWorldContext, UIAudioData.GetBackSound()); }
-    inline void PlayOpenSound(UWorld* InWorldContext)            { PlayUISound(InWorldContext, UIAudioData.GetOpenSound()); }
-    inline void PlayCloseSound(UWorld* InWorldContext)           { PlayUISound(InWorldContext, UIAudioData.GetCloseSound()); }
-    inline void PlayTabSwitchSound(UWorld* InWorldContext)       { PlayUISound(InWorldContext, UIAudioData.GetTabSwitchSound()); }
-    inline void PlayScrollSound(UWorld* InWorldContext)          { PlayUISound(InWorldContext, UIAudioData.GetScrollSound()); }
-    inline void PlayEquipSound(UWorld* InWorldContext)           { PlayUISound(InWorldContext, UIAudioData.GetEquipSound()); }
-    inline void PlayUnequipSound(UWorld* InWorldContext)         { PlayUISound(InWorldContext, UIAudioData.GetUnequipSound()); }
-    inline void PlayDropSound(UWorld* InWorldContext)            { PlayUISound(InWorldContext, UIAudioData.GetDropSound()); }
-    inline void PlayPickupSound(UWorld* InWorldContext)          { PlayUISound(InWorldContext, UIAudioData.GetPickupSound()); }
-    inline void PlayPurchaseSound(UWorld* InWorldContext)        { PlayUISound(InWorldContext, UIAudioData.GetPurchaseSound()); }
-    inline void PlaySellSound(UWorld* InWorldContext)            { PlayUISound(InWorldContext, UIAudioData.GetSellSound()); }
-    inline void PlayCraftSound(UWorld* InWorldContext)           { PlayUISound(InWorldContext, UIAudioData.GetCraftSound()); }
-    inline void PlayUpgradeSound(UWorld* InWorldContext)         { PlayUISound(InWorldContext, UIAudioData.GetUpgradeSound()); }
+    inline void PlayHoveredSound(UWorld* InWorldContext)         { PlayUISound(InWorldContext, EUISound::Hovered); }
+    inline void PlayPressedSound(UWorld* InWorldContext)         { PlayUISound(InWorldContext, EUISound::Pressed); }
+    inline void PlaySelectSound(UWorld* InWorldContext)          { PlayUISound(InWorldContext, EUISound::Select); }
+    inline void PlayExitSound(UWorld* InWorldContext)            { PlayUISound(InWorldContext, EUISound::Exit); }
+    inline void PlaySliderIncreaseSound(UWorld* InWorldContext)  { PlayUISound(InWorldContext, EUISound::SliderIncrease); }
+    inline void PlaySliderDecreaseSound(UWorld* InWorldContext)  { PlayUISound(InWorldContext, EUISound::SliderDecrease); }
+    inline void PlayErrorSound(UWorld* InWorldContext)           { PlayUISound(InWorldContext, EUISound::Error); }
+    inline void PlayAcceptSound(UWorld* InWorldContext)          { PlayUISound(InWorldContext, EUISound::Accept); }
+    inline void PlayDisabledSound(UWorld* InWorldContext)        { PlayUISound(InWorldContext, EUISound::Disabled); }
+    inline void PlayNotificationSound(UWorld* InWorldContext)    { PlayUISound(InWorldContext, EUISound::Notification); }
+    inline void PlayCancelSound(UWorld* InWorldContext)          { PlayUISound(InWorldContext, EUISound::Cancel); }
+    inline void PlayBackSound(UWorld* InWorldContext)            { PlayUISound(InWorldContext, EUISound::Back); }
+    inline void PlayOpenSound(UWorld* InWorldContext)            { PlayUISound(InWorldContext, EUISound::Open); }
+    inline void PlayCloseSound(UWorld* InWorldContext)           { PlayUISound(InWorldContext, EUISound::Close); }
+    inline void PlayTabSwitchSound(UWorld* InWorldContext)       { PlayUISound(InWorldContext, EUISound::TabSwitch); }
+    inline void PlayScrollSound(UWorld* InWorldContext)          { PlayUISound(InWorldContext, EUISound::Scroll); }
+    inline void PlayEquipSound(UWorld* InWorldContext)           { PlayUISound(InWorldContext, EUISound::Equip); }
+    inline void PlayUnequipSound(UWorld* InWorldContext)         { PlayUISound(InWorldContext, EUISound::Unequip); }
+    inline void PlayDropSound(UWorld* InWorldContext)            { PlayUISound(InWorldContext, EUISound::Drop); }
+    inline void PlayPickupSound(UWorld* InWorldContext)          { PlayUISound(InWorldContext, EUISound::Pickup); }
+    inline void PlayPurchaseSound(UWorld* InWorldContext)        { PlayUISound(InWorldContext, EUISound::Purchase); }
+    inline void PlaySellSound(UWorld* InWorldContext)            { PlayUISound(InWorldContext, EUISound::Sell); }
+    inline void PlayCraftSound(UWorld* InWorldContext)           { PlayUISound(InWorldContext, EUISound::Craft); }
+    inline void PlayUpgradeSound(UWorld* InWorldContext)         { PlayUISound(InWorldContext, EUISound::Upgrade); }
 
 #pragma endregion
 
@@ -754,14 +1237,17 @@ struct FUtilityAudioData
 
 private:
 
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> RifleFire;
+	FCachedSound RifleFire;
 
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> RifleReloadStart;
+	FCachedSound RifleReloadStart;
 
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> RifleReloadEnd;
+	FCachedSound RifleReloadEnd;
+
+	/** Looping burst sample, authored at UUtilityAudioManager::AutoFireReferenceRate */
+	FCachedSound RifleAutoFireLoop;
+
+	/** Played once when a burst ends */
+	FCachedSound RifleAutoFireTail;
 
 #pragma endregion
 
@@ -770,29 +1256,49 @@ private:
 #pragma region Constructor
 
 public:
+	static constexpr const TCHAR* RifleFirePath = TEXT("/Game/Blueprint/Audio/Utility/Weapon/Rifle/SC_Rifle_Fire.SC_Rifle_Fire");
+	static constexpr const TCHAR* RifleReloadStartPath = TEXT("/Game/Blueprint/Audio/Utility/Weapon/Rifle/SC_Rifle_ReloadStart.SC_Rifle_ReloadStart");
+	static constexpr const TCHAR* RifleReloadEndPath = TEXT("/Game/Blueprint/Audio/Utility/Weapon/Rifle/SC_Rifle_ReloadEnd.SC_Rifle_ReloadEnd");
+	static constexpr const TCHAR* RifleAutoFireLoopPath = TEXT("/Game/Blueprint/Audio/Utility/Weapon/Rifle/SC_Rifle_AutoFireLoop.SC_Rifle_AutoFireLoop");
+	static constexpr const TCHAR* RifleAutoFireTailPath = TEXT("/Game/Blueprint/Audio/Utility/Weapon/Rifle/SC_Rifle_AutoFireTail.SC_Rifle_AutoFireTail");
+
+	/** Construction only records sound IDs; call LoadUtilityAudioAssets to load */
 	FUtilityAudioData()
+		: RifleFire(RifleFirePath)
+		, RifleReloadStart(RifleReloadStartPath)
+		, RifleReloadEnd(RifleReloadEndPath)
+		, RifleAutoFireLoop(RifleAutoFireLoopPath)
+		, RifleAutoFireTail(RifleAutoFireTailPath)
 	{
-		LoadUtilityAudioAssets();
 	}
 
-	void LoadUtilityAudioAssets()
+	/** Game thread only: the cache's async loads must be requested there */
+	void LoadUtilityAudioAssets() const
 	{
+		check(IsInGameThread());
 		LoadWeaponAudioAssets();
 	}
 
-	void LoadWeaponAudioAssets()
+	/**
+	 * Starts streaming every weapon sound in. They stay evictable: the cache keeps them while they
+	 * play or are recently used. Plays made before a sound arrives are dropped.
+	 */
+	void LoadWeaponAudioAssets() const
 	{
-		// Rifle Audio Assets
-		// TODO: 
+		for (const FCachedSound* Sound : { &RifleFire, &RifleReloadStart, &RifleReloadEnd, &RifleAutoFireLoop, &RifleAutoFireTail })
+		{
+			Sound->Prefetch();
+		}
 	}
 
 #pragma endregion
 
 #pragma region Accessors
 
-	TObjectPtr<USoundBase> GetRifleFire() const
+	USoundBase* GetRifleFire() const
 	{
-		if (RifleFire == nullptr)
+		USoundBase* Sound = RifleFire.Get();
+		if (Sound == nullptr)
 		{
 #if DEV_DEBUG_MODE
 			LOG_ERROR("RifleFire sound is not assigned.");
@@ -804,12 +1310,13 @@ public:
 		LOG_INFO("RifleFire sound retrieved successfully.");
 #endif
 
-		return RifleFire;
+		return Sound;
 	}
 
-	TObjectPtr<USoundBase> GetRifleReloadStart() const
+	USoundBase* GetRifleReloadStart() const
 	{
-		if (RifleReloadStart == nullptr)
+		USoundBase* Sound = RifleReloadStart.Get();
+		if (Sound == nullptr)
 		{
 #if DEV_DEBUG_MODE
 			LOG_ERROR("RifleReloadStart sound is not assigned.");
@@ -821,12 +1328,13 @@ public:
 		LOG_INFO("RifleReloadStart sound retrieved successfully.");
 #endif
 
-		return RifleReloadStart;
+		return Sound;
 	}
 
-	TObjectPtr<USoundBase> GetRifleReloadEnd() const
+	USoundBase* GetRifleReloadEnd() const
 	{
-		if (RifleReloadEnd == nullptr)
+		USoundBase* Sound = RifleReloadEnd.Get();
+		if (Sound == nullptr)
 		{
 #if DEV_DEBUG_MODE
 			LOG_ERROR("RifleReloadEnd sound is not assigned.");
@@ -838,13 +1346,42 @@ public:
 		LOG_INFO("RifleReloadEnd sound retrieved successfully.");
 #endif
 
-		return RifleReloadEnd;
+		return Sound;
+	}
+
+	/** Null when no loop is authored; callers then fall back to per-shot one-shots */
+	USoundBase* GetRifleAutoFireLoop() const
+	{
+		return RifleAutoFireLoop.Get();
+	}
+
+	/** Optional; a burst without a tail just stops */
+	USoundBase* GetRifleAutoFireTail() const
+	{
+		return RifleAutoFireTail.Get();
 	}
 
 #pragma endregion
 
 };
 
+/** One automatic weapon's burst: a single looping voice reused for every burst of that weapon. */
+USTRUCT()
+struct FRifleAutoFireVoice
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TObjectPtr<UAudioComponent> LoopVoice = nullptr;
+
+	float RoundsPerMinute = 0.f;
+
+	/** True between StartRifleAutoFire and StopRifleAutoFire */
+	bool bFiring = false;
+
+	bool bInUse = false;
+};
+
 #pragma endregion
 
 #pragma region Manager
@@ -863,28 +1400,151 @@ public:
 
 #pragma region Data
 
+public:
+    /** The process-wide utility bank, shared with the UtilityAudio helpers */
+    const FUtilityAudioData& GetUtilityAudioData() const;
+
 protected:
-    UPROPERTY(VisibleAnywhere)
-    FUtilityAudioData UtilityAudioData;
+    /** Builds and loads the shared utility bank */
+    virtual void OnInitializeAudio() override;
+
+#pragma endregion
+
+#pragma region Pool
+
+protected:
+    /** Reusable voices for rifle fire; capacity is editable per manager */
+    UPROPERTY(EditAnywhere, Category = "Sound|Pool")
+    FAudioVoicePool RifleFirePool;
 
 public:
-    FUtilityAudioData GetUtilityAudioData() const
+    /** Returns the rifle fire voice pool, e.g. to read hit/miss counters */
+    const FAudioVoicePool& GetRifleFirePool() const
     {
-        return UtilityAudioData;
+        return RifleFirePool;
     }
 
-#pragma endregion
+    /** Sets how many rifle voices this manager keeps alive */
+    UFUNCTION(BlueprintCallable)
+    void SetRifleFirePoolCapacity(int32 InCapacity);
+
+    /** Releases the pooled voices */
+    virtual void BeginDestroy() override;
+
+#pragma endregion
+
+#pragma region Play
+
+    UFUNCTION(BlueprintCallable)
+    void PlayRifleFire(UWorld* InWorldContext);
+
+    /** Creates the pooled rifle voices ahead of the first shot */
+    UFUNCTION(BlueprintCallable)
+    void PrewarmRifleFirePool(UWorld* InWorldContext);
+
+    UFUNCTION(BlueprintCallable)
+    void PlayRifleReloadStart(UWorld* InWorldContext);
+
+    UFUNCTION(BlueprintCallable)
+    void PlayRifleReloadStop(UWorld* InWorldContext);
+
+#pragma endregion
+
+#pragma region AutoFire
+
+public:
+    /**
+     * Starts a burst for an automatic weapon on one looping voice instead of one voice per round.
+     * Semi-automatic weapons, or a missing loop sample, fall back to a single PlayRifleFire.
+     * @param Handle	Voice returned by an earlier call for the same weapon, or INDEX_NONE to allocate one.
+     * @return Handle to pass to SetRifleAutoFireRate / StopRifleAutoFire, or INDEX_NONE after a one-shot fallback.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Sound|AutoFire")
+    int32 StartRifleAutoFire(UWorld* InWorldContext, float RoundsPerMinute, bool bAutomatic = true, int32 Handle = -1);
+
+    /** Changes the fire rate of a running burst, e.g. while a weapon spins up */
+    UFUNCTION(BlueprintCallable, Category = "Sound|AutoFire")
+    void SetRifleAutoFireRate(int32 Handle, float RoundsPerMinute);
+
+    /** Stops the loop and plays the tail sample. The handle stays valid for the next burst. */
+    UFUNCTION(BlueprintCallable, Category = "Sound|AutoFire")
+    void StopRifleAutoFire(UWorld* InWorldContext, int32 Handle);
+
+    /** Stops the burst if needed and frees the voice, e.g. when the weapon is destroyed */
+    UFUNCTION(BlueprintCallable, Category = "Sound|AutoFire")
+    void ReleaseRifleAutoFire(int32 Handle);
+
+    /** Rate the loop sample was authored at; other rates are reached by pitching the loop */
+    UPROPERTY(EditAnywhere, Category = "Sound|AutoFire", meta = (ClampMin = "1"))
+    float AutoFireReferenceRate = 600.f;
+
+    /** Pitch range the rate is clamped to, so extreme rates do not distort the sample */
+    UPROPERTY(EditAnywhere, Category = "Sound|AutoFire")
+    FVector2D AutoFirePitchRange = FVector2D(0.5f, 2.f);
+
+    /** Fade applied to the loop on stop so the cut under the tail does not click */
+    UPROPERTY(EditAnywhere, Category = "Sound|AutoFire", meta = (ClampMin = "0"))
+    float AutoFireStopFadeSeconds = 0.02f;
+
+private:
+    UPROPERTY(Transient)
+    TArray<FRifleAutoFireVoice> AutoFireVoices;
+
+    TArray<int32> FreeAutoFireSlots;
+
+    FRifleAutoFireVoice* FindAutoFireVoice(int32 Handle);
+    void ApplyAutoFireRate(FRifleAutoFireVoice& Voice) const;
+
+#pragma endregion
+
+#pragma region Scheduling
+
+public:
+    /**
+     * Fires rifle rounds on a Quartz clock so the cadence is set by the audio renderer, not the game tick.
+     * Round N of the burst is queued against beat N of the clock's transport a few beats ahead; rounds
+     * whose beat has already passed after a hitch are dropped rather than played late.
+     * @param NumShots	Rounds in the burst, or 0 to fire until StopRifleFireCadence.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Sound|Scheduling")
+    void StartRifleFireCadence(UWorld* InWorldContext, float RoundsPerMinute, int32 NumShots = 0);
+
+    /** Retimes a running cadence; rounds already queued move with the beat grid */
+    UFUNCTION(BlueprintCallable, Category = "Sound|Scheduling")
+    void SetRifleFireCadenceRate(UWorld* InWorldContext, float RoundsPerMinute);
+
+    /** Stops the clock and cancels every round that has not started yet */
+    UFUNCTION(BlueprintCallable, Category = "Sound|Scheduling")
+    void StopRifleFireCadence(UWorld* InWorldContext);
+
+    UFUNCTION(BlueprintPure, Category = "Sound|Scheduling")
+    bool IsRifleFireCadenceActive() const { return bFireCadenceActive; }
+
+    /** Rounds kept queued ahead of the clock; must cover the longest expected frame plus one beat */
+    UPROPERTY(EditAnywhere, Category = "Sound|Scheduling", meta = (ClampMin = "2", UIMin = "2"))
+    int32 FireLookaheadBeats = 4;
+
+private:
+    /** One beat is one round */
+    UPROPERTY(Transient)
+    TObjectPtr<UQuartzClockHandle> FireClock = nullptr;
+
+    TWeakObjectPtr<UWorld> FireClockWorld;
 
-#pragma region Play
+    /** Transport beat the next queued round lands on */
+    int32 NextFireBeat = 0;
 
-    UFUNCTION(BlueprintCallable)
-    void PlayRifleFire(UWorld* InWorldContext);
+    /** INDEX_NONE while firing until stopped */
+    int32 FireShotsRemaining = INDEX_NONE;
 
-    UFUNCTION(BlueprintCallable)
-    void PlayRifleReloadStart(UWorld* InWorldContext);
+    bool bFireCadenceActive = false;
 
-    UFUNCTION(BlueprintCallable)
-    void PlayRifleReloadStop(UWorld* InWorldContext);
+    UQuartzClockHandle* GetFireClock(UWorld* InWorld);
+    void QueueFireBeats(UWorld* InWorld, int32 CurrentBeat);
+    void ReleaseFireClock();
+
+    UFUNCTION()
+    void HandleFireClockBeat(FName ClockName, EQuartzCommandQuantization QuantizationType, int32 NumBars, int32 Beat, float BeatFraction);
 
 #pragma endregion
 
@@ -898,7 +1558,15 @@ namespace UtilityAudio
 {
 #pragma region Data 
 
-    inline FUtilityAudioData UtilityAudioData;
+    /**
+     * The utility sound bank shared with UUtilityAudioManager. Built on first call rather than
+     * during static initialization, so module load does no asset work. Construction is thread-safe;
+     * the loads it starts always run on the game thread, deferred there if the first call is not.
+     */
+    AGEOFREVERSE_API const FUtilityAudioData& GetUtilityAudioData();
+
+    /** Shared rifle fire voices for the namespace helpers, kept alive by a GC referencer */
+    AGEOFREVERSE_API FAudioVoicePool& GetRifleFireVoicePool();
 
 #pragma endregion
 
@@ -918,7 +1586,7 @@ namespace UtilityAudio
             return;
         }
 
-        USoundBase* Sound = UtilityAudioData.GetRifleFire();
+        USoundBase* Sound = GetUtilityAudioData().GetRifleFire();
         if (Sound == nullptr)
         {
 #if DEV_DEBUG_MODE
@@ -927,11 +1595,7 @@ namespace UtilityAudio
             return;
         }
 
-#if DEV_DEBUG_MODE
-        LOG_INFO("Playing RifleFire");
-#endif
-
-        UGameplayStatics::PlaySound2D(InWorldContext, Sound);
+        GetRifleFireVoicePool().Play(InWorldContext, Sound);
     }
 
     inline void PlayRifleReloadStart(UWorld* InWorldContext)
@@ -944,7 +1608,7 @@ namespace UtilityAudio
             return;
         }
 
-        USoundBase* Sound = UtilityAudioData.GetRifleReloadStart();
+        USoundBase* Sound = GetUtilityAudioData().GetRifleReloadStart();
         if (Sound == nullptr)
         {
 #if DEV_DEBUG_MODE
@@ -957,7 +1621,8 @@ namespace UtilityAudio
         LOG_INFO("Playing RifleReloadStart sound");
 #endif
 
-        UGameplayStatics::PlaySound2D(InWorldContext, Sound);
+        // Goes through the category budget, voice registry and instrumentation like every other utility sound.
+        UAudioManager::PlaySound(InWorldContext, Sound, EAudioCategory::Utility);
     }
 
     inline void PlayRifleReloadEnd(UWorld* InWorldContext)
@@ -970,7 +1635,7 @@ namespace UtilityAudio
             return;
         }
 
-        USoundBase* Sound = UtilityAudioData.GetRifleReloadEnd();
+        USoundBase* Sound = GetUtilityAudioData().GetRifleReloadEnd();
         if (Sound == nullptr)
         {
 #if DEV_DEBUG_MODE
@@ -983,7 +1648,7 @@ namespace UtilityAudio
         LOG_INFO("Playing RifleReloadEnd sound");
 #endif
 
-        UGameplayStatics::PlaySound2D(InWorldContext, Sound);
+        UAudioManager::PlaySound(InWorldContext, Sound, EAudioCategory::Utility);
     }
 
 #pragma endregion
@@ -1008,15 +1673,20 @@ struct FCharacterAudioData
 {
 	GENERATED_BODY()
 
+public:
+	static constexpr int32 NumSurfaces = SurfaceType_Max;
+
 private:
+	// Struct-of-arrays indexed directly by EPhysicalSurface.
+	// SurfaceType_Default doubles as the fallback for surfaces without their own sound.
 	UPROPERTY(VisibleAnywhere)
-	TMap<EPhysicalSurfaceType, TObjectPtr<USoundBase>> FootstepSounds;
+	TObjectPtr<USoundBase> FootstepSounds[SurfaceType_Max];
 
 	UPROPERTY(VisibleAnywhere)
-	TMap<EPhysicalSurfaceType, TObjectPtr<USoundBase>> JumpSounds;
+	TObjectPtr<USoundBase> JumpSounds[SurfaceType_Max];
 
 	UPROPERTY(VisibleAnywhere)
-	TMap<EPhysicalSurfaceType, TObjectPtr<USoundBase>> LandSounds;
+	TObjectPtr<USoundBase> LandSounds[SurfaceType_Max];
 
 public:
 	FCharacterAudioData()
@@ -1026,6 +1696,35 @@ public:
 	{
 	};
 
+	// Accessors. One index plus one fallback load; no hashing.
+	USoundBase* GetFootstepSound(EPhysicalSurface Surface) const { return Resolve(FootstepSounds, Surface); }
+	USoundBase* GetJumpSound(EPhysicalSurface Surface) const { return Resolve(JumpSounds, Surface); }
+	USoundBase* GetLandSound(EPhysicalSurface Surface) const { return Resolve(LandSounds, Surface); }
+
+	// Setters. Use SurfaceType_Default to set the fallback entry.
+	void SetFootstepSound(EPhysicalSurface Surface, USoundBase* Sound) { Assign(FootstepSounds, Surface, Sound); }
+	void SetJumpSound(EPhysicalSurface Surface, USoundBase* Sound) { Assign(JumpSounds, Surface, Sound); }
+	void SetLandSound(EPhysicalSurface Surface, USoundBase* Sound) { Assign(LandSounds, Surface, Sound); }
+
+private:
+	using FSurfaceSoundArray = TObjectPtr<USoundBase>[SurfaceType_Max];
+
+	static FORCEINLINE USoundBase* Resolve(const FSurfaceSoundArray& Sounds, EPhysicalSurface Surface)
+	{
+		const uint32 Index = static_cast<uint32>(Surface);
+		USoundBase* Sound = Index < static_cast<uint32>(SurfaceType_Max) ? Sounds[Index].Get() : nullptr;
+		return Sound ? Sound : Sounds[SurfaceType_Default].Get();
+	}
+
+	static void Assign(FSurfaceSoundArray& Sounds, EPhysicalSurface Surface, USoundBase* Sound)
+	{
+		const uint32 Index = static_cast<uint32>(Surface);
+		if (Index < static_cast<uint32>(SurfaceType_Max))
+		{
+			Sounds[Index] = Sound;
+		}
+	}
+
 };
 
 #pragma endregion
@@ -1044,6 +1743,46 @@ public:
 
 #pragma endregion
 
+#pragma region Data
+
+protected:
+    UPROPERTY(VisibleAnywhere)
+    FCharacterAudioData CharacterAudioData;
+
+public:
+    const FCharacterAudioData& GetCharacterAudioData() const
+    {
+        return CharacterAudioData;
+    }
+
+    UFUNCTION(BlueprintCallable)
+    void SetFootstepSound(TEnumAsByte<EPhysicalSurface> Surface, USoundBase* Sound);
+
+    UFUNCTION(BlueprintCallable)
+    void SetJumpSound(TEnumAsByte<EPhysicalSurface> Surface, USoundBase* Sound);
+
+    UFUNCTION(BlueprintCallable)
+    void SetLandSound(TEnumAsByte<EPhysicalSurface> Surface, USoundBase* Sound);
+
+#pragma endregion
+
+#pragma region Play
+
+public:
+    /** Plays the footstep for Surface at Location, falling back to the default-surface footstep */
+    UFUNCTION(BlueprintCallable)
+    void PlayFootstep(UWorld* InWorldContext, TEnumAsByte<EPhysicalSurface> Surface, FVector Location, float VolumeMultiplier = 1.f);
+
+    /** Plays the jump sound for Surface at Location, falling back to the default-surface jump */
+    UFUNCTION(BlueprintCallable)
+    void PlayJump(UWorld* InWorldContext, TEnumAsByte<EPhysicalSurface> Surface, FVector Location, float VolumeMultiplier = 1.f);
+
+    /** Plays the landing sound for Surface at Location, falling back to the default-surface landing */
+    UFUNCTION(BlueprintCallable)
+    void PlayLand(UWorld* InWorldContext, TEnumAsByte<EPhysicalSurface> Surface, FVector Location, float VolumeMultiplier = 1.f);
+
+#pragma endregion
+
 };
 
 #pragma endregion
@@ -1069,54 +1808,96 @@ struct FEnvironmentAudioData
 	GENERATED_BODY()
 
 private:
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> WindSound;
+	FCachedSound WindSound;
 
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> RainSound;
+	FCachedSound RainSound;
 
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> ThunderSound;
+	FCachedSound ThunderSound;
 
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USoundBase> ForestAmbientSound;
+	FCachedSound ForestAmbientSound;
 
 public:
+	static constexpr const TCHAR* WindSoundPath = TEXT("/Game/Blueprint/Audio/Environment/Wind/Wave_Env_Wind");
+	static constexpr const TCHAR* RainSoundPath = TEXT("/Game/Blueprint/Audio/Environment/Rain/Wave_Env_Rain");
+	static constexpr const TCHAR* ThunderSoundPath = TEXT("/Game/Blueprint/Audio/Environment/Thunder/Wave_Env_Thunder");
+	static constexpr const TCHAR* ForestAmbientSoundPath = TEXT("/Game/Blueprint/Audio/Environment/Forest/Wave_Env_ForestAmbient");
+
 	FEnvironmentAudioData()
-		: WindSound(nullptr)
-		, RainSound(nullptr)
-		, ThunderSound(nullptr)
-		, ForestAmbientSound(nullptr)
+		: WindSound(WindSoundPath)
+		, RainSound(RainSoundPath)
+		, ThunderSound(ThunderSoundPath)
+		, ForestAmbientSound(ForestAmbientSoundPath)
 	{
-		LoadEnvironmentAudioAssets();
 	}
 
+	/** Starts streaming the environment sounds in; looping ambience is kept by the cache while it plays */
 	void LoadEnvironmentAudioAssets()
 	{
-		auto LoadSound = [](TObjectPtr<USoundBase>& SoundVar, const TCHAR* Path, const TCHAR* Name)
+		for (const FCachedSound* Sound : { &WindSound, &RainSound, &ThunderSound, &ForestAmbientSound })
 		{
-			if (SoundVar = LoadObject<USoundBase>(nullptr, Path))
-			{
-				UE_LOG(LogTemp, Log, TEXT("[FEnvironmentAudioData] %s loaded successfully."), Name);
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("[FEnvironmentAudioData] Failed to load %s."), Name);
-			}
-		};
-
-		LoadSound(WindSound, TEXT("/Game/Blueprint/Audio/Environment/Wind/Wave_Env_Wind"), TEXT("WindSound"));
-		LoadSound(RainSound, TEXT("/Game/Blueprint/Audio/Environment/Rain/Wave_Env_Rain"), TEXT("RainSound"));
-		LoadSound(ThunderSound, TEXT("/Game/Blueprint/Audio/Environment/Thunder/Wave_Env_Thunder"), TEXT("ThunderSound"));
-		LoadSound(ForestAmbientSound, TEXT("/Game/Blueprint/Audio/Environment/Forest/Wave_Env_ForestAmbient"), TEXT("ForestAmbientSound"));
+			Sound->Prefetch();
+		}
 	}
 
 	// Accessors
-	USoundBase* GetWindSound() const { return WindSound; }
-	USoundBase* GetRainSound() const { return RainSound; }
-	USoundBase* GetThunderSound() const { return ThunderSound; }
-	USoundBase* GetForestAmbientSound() const { return ForestAmbientSound; }
+	USoundBase* GetWindSound() const { return WindSound.Get(); }
+	USoundBase* GetRainSound() const { return RainSound.Get(); }
+	USoundBase* GetThunderSound() const { return ThunderSound.Get(); }
+	USoundBase* GetForestAmbientSound() const { return ForestAmbientSound.Get(); }
+};
+#pragma endregion
+
+#pragma region VirtualVoice
+
+/**
+ * A looping environment emitter. While out of range it is only this record; while audible it
+ * also owns a real audio component. Playback position is derived from the audio clock so it
+ * carries across promotion and demotion.
+ */
+USTRUCT()
+struct FEnvironmentVirtualVoice
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TObjectPtr<USoundBase> Sound = nullptr;
+
+	/** Set only while the emitter is promoted to a real voice */
+	UPROPERTY(Transient)
+	TObjectPtr<UAudioComponent> RealVoice = nullptr;
+
+	FVector Location = FVector::ZeroVector;
+	float VolumeMultiplier = 1.f;
+	float PitchMultiplier = 1.f;
+
+	/** Loop length in seconds; zero when the sound cannot report one */
+	float LoopDuration = 0.f;
+
+	/** Playback position at BaseTime */
+	float BasePosition = 0.f;
+	double BaseTime = 0.0;
+
+	bool bInUse = false;
+
+	/** Current position inside the loop at audio time Now */
+	float GetPlaybackPosition(double Now) const
+	{
+		if (LoopDuration <= 0.f)
+		{
+			return 0.f;
+		}
+		const double Elapsed = (Now - BaseTime) * PitchMultiplier;
+		return static_cast<float>(FMath::Fmod(BasePosition + Elapsed, static_cast<double>(LoopDuration)));
+	}
+
+	/** Folds the elapsed time into BasePosition, e.g. before a parameter change */
+	void Rebase(double Now)
+	{
+		BasePosition = GetPlaybackPosition(Now);
+		BaseTime = Now;
+	}
 };
+
 #pragma endregion
 
 #pragma region Manager
@@ -1131,6 +1912,90 @@ class AGEOFREVERSE_API UEnvironmentAudioManager : public UAudioManager
 public:
     UEnvironmentAudioManager(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+    /** Stops real voices and unregisters the update ticker */
+    virtual void BeginDestroy() override;
+
+#pragma endregion
+
+#pragma region Data
+
+protected:
+    /** Sound handles only; nothing is loaded until InitializeAudio */
+    FEnvironmentAudioData EnvironmentAudioData;
+
+    /** Warms the sound cache with the environment sounds */
+    virtual void OnInitializeAudio() override;
+
+public:
+    const FEnvironmentAudioData& GetEnvironmentAudioData() const
+    {
+        return EnvironmentAudioData;
+    }
+
+#pragma endregion
+
+#pragma region VirtualVoice
+
+public:
+    /**
+     * Registers a looping emitter such as wind, rain or forest ambience.
+     * It starts virtual and is promoted once a listener gets in range.
+     * @return Handle used by the other emitter functions, or INDEX_NONE on failure.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Sound|Environment")
+    int32 AddLoopingEmitter(UObject* WorldContextObject, USoundBase* Sound, FVector Location, float VolumeMultiplier = 1.f, float PitchMultiplier = 1.f);
+
+    UFUNCTION(BlueprintCallable, Category = "Sound|Environment")
+    void RemoveLoopingEmitter(int32 Handle);
+
+    UFUNCTION(BlueprintCallable, Category = "Sound|Environment")
+    void SetEmitterLocation(int32 Handle, FVector Location);
+
+    UFUNCTION(BlueprintCallable, Category = "Sound|Environment")
+    void SetEmitterVolume(int32 Handle, float VolumeMultiplier);
+
+    UFUNCTION(BlueprintCallable, Category = "Sound|Environment")
+    void SetEmitterPitch(int32 Handle, float PitchMultiplier);
+
+    /** Upper bound on emitters that hold a real voice at once; closest audible ones win */
+    UFUNCTION(BlueprintCallable, Category = "Sound|Environment")
+    void SetMaxRealVoices(int32 InMaxRealVoices);
+
+    /** Emitters with a volume multiplier below this stay virtual regardless of distance */
+    UFUNCTION(BlueprintCallable, Category = "Sound|Environment")
+    void SetAudibilityThreshold(float InMinVolume);
+
+    int32 GetRealVoiceCount() const;
+    int32 GetVirtualVoiceCount() const;
+
+protected:
+    /** Seconds between promote/demote passes */
+    UPROPERTY(EditAnywhere, Category = "Sound|Environment")
+    float VirtualVoiceUpdateInterval = 0.1f;
+
+    /** Extra range, as a fraction of the attenuation radius, before a real voice is demoted */
+    UPROPERTY(EditAnywhere, Category = "Sound|Environment")
+    float DemoteHysteresis = 0.1f;
+
+    UPROPERTY(EditAnywhere, Category = "Sound|Environment")
+    int32 MaxRealVoices = 24;
+
+    UPROPERTY(EditAnywhere, Category = "Sound|Environment")
+    float AudibilityThreshold = 0.01f;
+
+private:
+    UPROPERTY(Transient)
+    TArray<FEnvironmentVirtualVoice> Emitters;
+
+    TArray<int32> FreeEmitterSlots;
+    TWeakObjectPtr<UWorld> EmitterWorld;
+    FTSTicker::FDelegateHandle VirtualVoiceTickHandle;
+
+    FEnvironmentVirtualVoice* FindEmitter(int32 Handle);
+    bool TickVirtualVoices(float DeltaTime);
+    void PromoteVoice(UWorld* World, FEnvironmentVirtualVoice& Voice, double Now);
+    void DemoteVoice(FEnvironmentVirtualVoice& Voice, double Now);
+
 #pragma endregion
 
 };
@@ -1149,6 +2014,16 @@ public:
 
 #pragma region Data
 
+UENUM(BlueprintType)
+enum class EMusicGenre : uint8
+{
+	Ambient,
+	ElectroAtmosphere,
+	Calm,
+	Intense,
+	Count UMETA(Hidden)
+};
+
 USTRUCT(BlueprintType)
 struct FAmbientMusic
 {
@@ -1156,21 +2031,27 @@ struct FAmbientMusic
 
 private:
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> PeacefulTracks;
+	TArray<TSoftObjectPtr<USoundWave>> PeacefulTracks;
 
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> NaturalTracks;
+	TArray<TSoftObjectPtr<USoundWave>> NaturalTracks;
 
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> FuturisticTracks;
+	TArray<TSoftObjectPtr<USoundWave>> FuturisticTracks;
 
 public:
 	FAmbientMusic()
 	{
-		LoadAmbientMusicAssets();
 	}
 
 	void LoadAmbientMusicAssets() {}
+
+	void GatherTracks(TArray<TSoftObjectPtr<USoundWave>>& OutTracks) const
+	{
+		OutTracks.Append(PeacefulTracks);
+		OutTracks.Append(NaturalTracks);
+		OutTracks.Append(FuturisticTracks);
+	}
 };
 
 USTRUCT(BlueprintType)
@@ -1180,27 +2061,34 @@ struct FElectroAtmosphereMusic
 
 private:
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> SynthwaveTracks;
+	TArray<TSoftObjectPtr<USoundWave>> SynthwaveTracks;
 
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> DarkWaveTracks;
+	TArray<TSoftObjectPtr<USoundWave>> DarkWaveTracks;
 
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> FutureBassTracks;
+	TArray<TSoftObjectPtr<USoundWave>> FutureBassTracks;
 
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> CyberpunkTracks;
+	TArray<TSoftObjectPtr<USoundWave>> CyberpunkTracks;
 
 public:
 	FElectroAtmosphereMusic()
 	{
-		LoadElectroAtmosphereMusicAssets();
 	}
 
 	void LoadElectroAtmosphereMusicAssets()
 	{
 
 	}
+
+	void GatherTracks(TArray<TSoftObjectPtr<USoundWave>>& OutTracks) const
+	{
+		OutTracks.Append(SynthwaveTracks);
+		OutTracks.Append(DarkWaveTracks);
+		OutTracks.Append(FutureBassTracks);
+		OutTracks.Append(CyberpunkTracks);
+	}
 };
 
 USTRUCT(BlueprintType)
@@ -1210,17 +2098,24 @@ struct FCalmMusic
 
 private:
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> SoftTracks;
+	TArray<TSoftObjectPtr<USoundWave>> SoftTracks;
 
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> LofiTracks;
+	TArray<TSoftObjectPtr<USoundWave>> LofiTracks;
 
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> ChillTracks;
+	TArray<TSoftObjectPtr<USoundWave>> ChillTracks;
 
 public:
-	FCalmMusic() { LoadCalmMusicAssets(); }
+	FCalmMusic() {}
 	void LoadCalmMusicAssets() {}
+
+	void GatherTracks(TArray<TSoftObjectPtr<USoundWave>>& OutTracks) const
+	{
+		OutTracks.Append(SoftTracks);
+		OutTracks.Append(LofiTracks);
+		OutTracks.Append(ChillTracks);
+	}
 };
 
 USTRUCT(BlueprintType)
@@ -1230,26 +2125,36 @@ struct FIntenseMusic
 
 private:
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> TechnoTracks;
+	TArray<TSoftObjectPtr<USoundWave>> TechnoTracks;
 
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> TranceTracks;
+	TArray<TSoftObjectPtr<USoundWave>> TranceTracks;
 
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> DubstepTracks;
+	TArray<TSoftObjectPtr<USoundWave>> DubstepTracks;
 
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> IndustrialTracks;
+	TArray<TSoftObjectPtr<USoundWave>> IndustrialTracks;
 
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> DrumAndBassTracks;
+	TArray<TSoftObjectPtr<USoundWave>> DrumAndBassTracks;
 
 	UPROPERTY(VisibleAnywhere)
-	TArray<USoundWave*> GlitchHopTracks;
+	TArray<TSoftObjectPtr<USoundWave>> GlitchHopTracks;
 
 public:
-	FIntenseMusic() { LoadIntenseMusicAssets(); }
+	FIntenseMusic() {}
 	void LoadIntenseMusicAssets() {}
+
+	void GatherTracks(TArray<TSoftObjectPtr<USoundWave>>& OutTracks) const
+	{
+		OutTracks.Append(TechnoTracks);
+		OutTracks.Append(TranceTracks);
+		OutTracks.Append(DubstepTracks);
+		OutTracks.Append(IndustrialTracks);
+		OutTracks.Append(DrumAndBassTracks);
+		OutTracks.Append(GlitchHopTracks);
+	}
 };
 
 USTRUCT(BlueprintType)
@@ -1276,6 +2181,19 @@ struct FBackgroundMusic
 		, IntenseMusic()
 	{
 	}
+
+	/** Appends the soft references of every track in Genre; nothing is loaded */
+	void GatherTracks(EMusicGenre Genre, TArray<TSoftObjectPtr<USoundWave>>& OutTracks) const
+	{
+		switch (Genre)
+		{
+		case EMusicGenre::Ambient:				AmbientMusic.GatherTracks(OutTracks); break;
+		case EMusicGenre::ElectroAtmosphere:	ElectroAtmosphereMusic.GatherTracks(OutTracks); break;
+		case EMusicGenre::Calm:					CalmMusic.GatherTracks(OutTracks); break;
+		case EMusicGenre::Intense:				IntenseMusic.GatherTracks(OutTracks); break;
+		default: break;
+		}
+	}
 };
 
 USTRUCT()
@@ -1295,14 +2213,134 @@ public:
 		: MainMenuMusic(nullptr)
 		, BackgroundMusic()
 	{
-		LoadMusicAssets();
 	}
 
+	/** Loads the music catalog; construction does no asset work */
 	void LoadMusicAssets()
 	{
+		BackgroundMusic.AmbientMusic.LoadAmbientMusicAssets();
+		BackgroundMusic.ElectroAtmosphereMusic.LoadElectroAtmosphereMusicAssets();
+		BackgroundMusic.CalmMusic.LoadCalmMusicAssets();
+		BackgroundMusic.IntenseMusic.LoadIntenseMusicAssets();
+	}
+
+	const FBackgroundMusic& GetBackgroundMusic() const { return BackgroundMusic; }
+
+};
+
+#pragma endregion
 
+#pragma region Streaming
+
+/**
+ * Keeps only the music that is playing or about to play resident.
+ * Tracks are loaded through the streamable manager, so the async loading thread does the work;
+ * waves are switched to on-demand loading so playback pulls audio in chunks.
+ * Each genre has a byte budget; least recently used tracks are released when it is exceeded.
+ */
+struct AGEOFREVERSE_API FMusicTrackStreamer
+{
+	DECLARE_DELEGATE_OneParam(FOnTrackReady, USoundWave* /*Track*/);
+
+	/**
+	 * Load callbacks are bound weakly to InOwner, which must own this streamer, so none can run after it is gone.
+	 * Must be set before the first request.
+	 */
+	void SetOwner(UObject* InOwner)
+	{
+		Owner = InOwner;
 	}
 
+	/** Loads Track if needed and calls OnReady with the result (null on failure) */
+	void RequestTrack(EMusicGenre Genre, const TSoftObjectPtr<USoundWave>& Track, FOnTrackReady OnReady);
+
+	/** Starts loading Track and primes its first chunk without playing it */
+	void PrefetchTrack(EMusicGenre Genre, const TSoftObjectPtr<USoundWave>& Track);
+
+	/** Marks Track as playing; it is never released while pinned */
+	void SetPinnedTrack(EMusicGenre Genre, const FSoftObjectPath& Track);
+
+	void SetGenreBudget(EMusicGenre Genre, int64 InBudgetBytes);
+	int64 GetGenreResidentBytes(EMusicGenre Genre) const;
+
+	/** Drops every handle so the tracks can be garbage collected */
+	void ReleaseAll();
+
+private:
+	struct FResidentTrack
+	{
+		FSoftObjectPath Path;
+		TSharedPtr<FStreamableHandle> Handle;
+		int64 Bytes = 0;
+		double LastUsedTime = 0.0;
+	};
+
+	struct FGenreCache
+	{
+		TArray<FResidentTrack> Tracks;
+		FSoftObjectPath Pinned;
+		FSoftObjectPath Prefetched;
+		int64 BudgetBytes = 4 * 1024 * 1024;
+	};
+
+	FGenreCache Genres[static_cast<int32>(EMusicGenre::Count)];
+	TWeakObjectPtr<UObject> Owner;
+
+	FResidentTrack& FindOrAddTrack(EMusicGenre Genre, const FSoftObjectPath& Path);
+	FStreamableDelegate MakeLoadedDelegate(EMusicGenre Genre, const FSoftObjectPath& Path, bool bPrime, FOnTrackReady OnReady);
+	void HandleTrackLoaded(EMusicGenre Genre, FSoftObjectPath Path, bool bPrime, FOnTrackReady OnReady);
+	void EnforceBudget(EMusicGenre Genre);
+};
+
+#pragma endregion
+
+#pragma region Playlist
+
+/**
+ * Shuffle without repeats: every track of a genre plays once per pass,
+ * and a new pass never opens with the track that closed the previous one.
+ */
+struct AGEOFREVERSE_API FMusicShuffleBag
+{
+	/** Index of the track that would play next, refilling the bag if needed */
+	int32 Peek(int32 NumTracks, FRandomStream& Stream);
+
+	/** Consumes and returns the next track index */
+	int32 Next(int32 NumTracks, FRandomStream& Stream);
+
+private:
+	TArray<int32> Order;
+	int32 Cursor = 0;
+	int32 LastPlayed = INDEX_NONE;
+
+	void Refill(int32 NumTracks, FRandomStream& Stream);
+};
+
+#pragma endregion
+
+#pragma region Intensity
+
+/** Adaptive music states, ordered from lowest to highest intensity */
+UENUM(BlueprintType)
+enum class EMusicIntensityState : uint8
+{
+	Calm,
+	Ambient,
+	Intense,
+	Count UMETA(Hidden)
+};
+
+/** Whether one intensity state may directly follow another, and how long the crossfade takes */
+USTRUCT(BlueprintType)
+struct FMusicTransitionRule
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere)
+	bool bAllowed = true;
+
+	UPROPERTY(EditAnywhere)
+	float CrossfadeSeconds = 3.f;
 };
 
 #pragma endregion
@@ -1319,6 +2357,162 @@ class AGEOFREVERSE_API UMusicManager : public UAudioManager
 public:
     UMusicManager(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+    /** Stops playback and releases every streamed track */
+    virtual void BeginDestroy() override;
+
+#pragma endregion
+
+#pragma region Data
+
+protected:
+    UPROPERTY(VisibleAnywhere)
+    FMusicAudioData MusicAudioData;
+
+    virtual void OnInitializeAudio() override;
+
+#pragma endregion
+
+#pragma region Streaming
+
+public:
+    /** Crossfades to the next track of Genre and keeps the playlist running from there */
+    UFUNCTION(BlueprintCallable, Category = "Sound|Music")
+    void PlayGenre(UObject* WorldContextObject, EMusicGenre Genre);
+
+    UFUNCTION(BlueprintCallable, Category = "Sound|Music")
+    void StopMusic();
+
+    /** Caps how much audio data a genre may keep resident */
+    UFUNCTION(BlueprintCallable, Category = "Sound|Music")
+    void SetGenreMemoryBudget(EMusicGenre Genre, int32 BudgetKilobytes);
+
+    int64 GetGenreResidentBytes(EMusicGenre Genre) const
+    {
+        return TrackStreamer.GetGenreResidentBytes(Genre);
+    }
+
+private:
+    FMusicTrackStreamer TrackStreamer;
+    TWeakObjectPtr<UWorld> MusicWorld;
+    EMusicGenre CurrentGenre = EMusicGenre::Ambient;
+
+#pragma endregion
+
+#pragma region Playlist
+
+public:
+    /** Length of the equal-power crossfade between tracks; zero gives back-to-back gapless playback */
+    UFUNCTION(BlueprintCallable, Category = "Sound|Music")
+    void SetCrossfadeDuration(float InSeconds);
+
+protected:
+    UPROPERTY(EditAnywhere, Category = "Sound|Music")
+    float CrossfadeDuration = 3.f;
+
+    /** How long before a transition the next track is requested and primed */
+    UPROPERTY(EditAnywhere, Category = "Sound|Music")
+    float TransitionLookahead = 8.f;
+
+    /** Two persistent components; tracks alternate between them so one can fade out while the other fades in */
+    UPROPERTY(Transient)
+    TObjectPtr<UAudioComponent> Decks[2];
+
+    /** Loaded and primed successor, started when the active track reaches its transition point */
+    UPROPERTY(Transient)
+    TObjectPtr<USoundWave> QueuedTrack = nullptr;
+
+private:
+    FMusicShuffleBag ShuffleBags[static_cast<int32>(EMusicGenre::Count)];
+    FRandomStream ShuffleStream;
+
+    int32 ActiveDeck = 0;
+    double ActiveTrackStartTime = 0.0;
+    float ActiveTrackDuration = 0.f;
+    bool bNextTrackRequested = false;
+
+    bool bFading = false;
+    double FadeStartTime = 0.0;
+
+    /** Equal-power gain table, built on a worker thread the first time music plays */
+    TFuture<TArray<float>> FadeCurveTask;
+    TArray<float> FadeCurve;
+
+    FTSTicker::FDelegateHandle PlaylistTickHandle;
+
+    /** Crossfade used by the transition in progress; intensity changes override the playlist default */
+    float ActiveCrossfade = 0.f;
+    float NextCrossfadeOverride = -1.f;
+
+    /** Crossfade the next StartOnIncomingDeck will use */
+    float GetNextCrossfade() const
+    {
+        return NextCrossfadeOverride >= 0.f ? NextCrossfadeOverride : CrossfadeDuration;
+    }
+
+    /** Returns the next track of Genre from its shuffle bag; bAdvance consumes it */
+    TSoftObjectPtr<USoundWave> PickNextTrack(EMusicGenre Genre, bool bAdvance);
+    void RequestNextTrack(EMusicGenre Genre, bool bImmediate);
+    void HandleTrackReady(USoundWave* Track, EMusicGenre Genre, bool bImmediate);
+    void StartOnIncomingDeck(UWorld* World, USoundWave* Track);
+    bool TickPlaylist(float DeltaTime);
+    float GetFadeGain(float Alpha);
+
+#pragma endregion
+
+#pragma region Intensity
+
+public:
+    /**
+     * Feeds the current gameplay intensity (0..1). Safe to call every frame: the decision is a
+     * clamp, a bucket index and one lookup in the precomputed table.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Sound|Music")
+    void SetIntensity(UObject* WorldContextObject, float Intensity);
+
+    UFUNCTION(BlueprintPure, Category = "Sound|Music")
+    EMusicIntensityState GetIntensityState() const { return IntensityState; }
+
+    /** Rebuilds the lookup table after thresholds or transition rules change */
+    UFUNCTION(BlueprintCallable, Category = "Sound|Music")
+    void RebuildIntensityTable();
+
+protected:
+    /** Intensity at which Calm rises to Ambient */
+    UPROPERTY(EditAnywhere, Category = "Sound|Music|Intensity")
+    float AmbientThreshold = 0.35f;
+
+    /** Intensity at which Ambient rises to Intense */
+    UPROPERTY(EditAnywhere, Category = "Sound|Music|Intensity")
+    float IntenseThreshold = 0.7f;
+
+    /** How far below a threshold intensity must drop before the state falls back */
+    UPROPERTY(EditAnywhere, Category = "Sound|Music|Intensity")
+    float IntensityHysteresis = 0.1f;
+
+    /** Shortest time a state is held before another change is allowed */
+    UPROPERTY(EditAnywhere, Category = "Sound|Music|Intensity")
+    float MinStateDuration = 4.f;
+
+    /** Row-major [From * Count + To] */
+    UPROPERTY(EditAnywhere, Category = "Sound|Music|Intensity")
+    FMusicTransitionRule TransitionRules[static_cast<int32>(EMusicIntensityState::Count) * static_cast<int32>(EMusicIntensityState::Count)];
+
+private:
+    static constexpr int32 IntensityResolution = 128;
+
+    /** Next state for every (current state, intensity bucket) pair */
+    uint8 IntensityTable[static_cast<int32>(EMusicIntensityState::Count)][IntensityResolution] = {};
+    bool bIntensityTableBuilt = false;
+
+    EMusicIntensityState IntensityState = EMusicIntensityState::Calm;
+    bool bIntensityStarted = false;
+    double LastStateChangeTime = 0.0;
+
+    const FMusicTransitionRule& GetTransitionRule(EMusicIntensityState From, EMusicIntensityState To) const
+    {
+        return TransitionRules[static_cast<int32>(From) * static_cast<int32>(EMusicIntensityState::Count) + static_cast<int32>(To)];
+    }
+
 #pragma endregion
 
 };
@@ -5,6 +5,19 @@
 #include "CoreMinimal.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include <atomic>
 #include "UObject/NoExportTypes.h"
 
 /**
@@ -42,19 +55,86 @@
 // Usage: LOG("Your log message here.");
 #define LOG(Message) UE_LOG(LogTemp, Log, TEXT(Message))
 
+/**
+ * @brief Highest verbosity compiled into the binary.
+ *
+ * 1 = Error, 2 = Warning, 3 = Info (Display), 4 = Verbose.
+ * LOG_ERROR, LOG_INFO, LOG_VERBOSE and the SAFE_GETTER success path above this level compile to nothing.
+*/
+#ifndef DIAG_COMPILED_VERBOSITY
+    #if UE_BUILD_SHIPPING || UE_BUILD_TEST
+        #define DIAG_COMPILED_VERBOSITY 2
+    #else
+        #define DIAG_COMPILED_VERBOSITY 4
+    #endif
+#endif
+
+/**
+ * @brief Routes LOG_ERROR, LOG_INFO, LOG_VERBOSE and SAFE_GETTER through the binary log.
+ *
+ * Set to 1 to record a static call-site ID plus raw arguments per call and format nothing at runtime;
+ * decode the session afterwards with diag.DecodeBinaryLog. Errors are still sent to UE_LOG as well.
+ * Set to 0 to use UE_LOG directly. Off by default in Shipping.
+*/
+#ifndef DIAG_BINARY_LOGGING
+    #if UE_BUILD_SHIPPING
+        #define DIAG_BINARY_LOGGING 0
+    #else
+        #define DIAG_BINARY_LOGGING 1
+    #endif
+#endif
+
+#define DIAG_VERBOSITY_ERROR 1
+#define DIAG_VERBOSITY_WARNING 2
+#define DIAG_VERBOSITY_INFO 3
+#define DIAG_VERBOSITY_VERBOSE 4
+
+// Records one binary log entry. The call site is registered once; later calls only copy the ID and arguments.
+// Format uses ordered placeholders ({0}, {1}, ...) which are filled in by the decoder; any other brace is literal.
+#define DIAG_RECORD(VerbosityLevel, Format, ...) \
+do \
+{ \
+    static const uint32 DiagSiteId = FDiagnosticBinaryLog::RegisterSite(VerbosityLevel, TEXT(__FILE__), __LINE__, TEXT(__FUNCTION__), Format); \
+    FDiagnosticBinaryLog::Record(DiagSiteId, ##__VA_ARGS__); \
+} while (0)
+
+#define DIAG_COMPILED_OUT() do { } while (0)
+
 // Logs an error message to the console with additional context including the current function name, 
 // line number, and the filename where the error occurred, along with a custom message.
 // Usage: LOG_ERROR("Your error message here.");
+// Errors always reach UE_LOG so crash reports and the console still see them; the binary log keeps a copy.
+#if DIAG_BINARY_LOGGING
+#define LOG_ERROR(Message) \
+do \
+{ \
+    DIAG_RECORD(DIAG_VERBOSITY_ERROR, TEXT(Message)); \
+    UE_LOG(LogTemp, Error, TEXT("%s:%d: %s: %s"), TEXT(__FILE__), __LINE__, TEXT(__FUNCTION__), TEXT(Message)); \
+} while (0)
+#else
 #define LOG_ERROR(Message) \
 UE_LOG(LogTemp, Error, TEXT("%s:%d: %s: %s"), TEXT(__FILE__), __LINE__, TEXT(__FUNCTION__), TEXT(Message))
+#endif
 
 // Logs an informational message to the console.
 // Usage: LOG_INFO("Your informational message here.");
+#if DIAG_COMPILED_VERBOSITY < DIAG_VERBOSITY_INFO
+#define LOG_INFO(Message) DIAG_COMPILED_OUT()
+#elif DIAG_BINARY_LOGGING
+#define LOG_INFO(Message) DIAG_RECORD(DIAG_VERBOSITY_INFO, TEXT(Message))
+#else
 #define LOG_INFO(Message) UE_LOG(LogTemp, Display, TEXT(Message))
+#endif
 
 // Logs a verbose message to the console.
 // Usage: LOG_VERBOSE("Your verbose message here.");
+#if DIAG_COMPILED_VERBOSITY < DIAG_VERBOSITY_VERBOSE
+#define LOG_VERBOSE(Message) DIAG_COMPILED_OUT()
+#elif DIAG_BINARY_LOGGING
+#define LOG_VERBOSE(Message) DIAG_RECORD(DIAG_VERBOSITY_VERBOSE, TEXT(Message))
+#else
 #define LOG_VERBOSE(Message) UE_LOG(LogTemp, Verbose, TEXT(Message))
+#endif
 
 // Logs a fatal error message to the console and terminates the program.
 // Usage: LOG_FATAL("Your fatal error message here.");
@@ -113,18 +193,13 @@ if (GEngine) \
 
 
 // Logs an invalid object message to the screen using DiagnosticSystem.
+// Repeated hits from the same call site are rate limited: at most one message per diag.InvalidLogInterval
+// seconds, with the hits in between collapsed into a single "xN" line. Hits still pending when the
+// interval never comes round again are printed by diag.InvalidStats and at exit.
 // Usage: LOG_INVALID(YourObject);
 // Example: LOG_INVALID(WeaponData);
 #define LOG_INVALID(InvalidObjectInput) \
-if (GEngine) \
-{ \
-    DiagnosticSystem::LogInvalid( \
-        TEXT(#InvalidObjectInput), \
-        TEXT(__FUNCTION__), \
-        TEXT(__FILE__), \
-        __LINE__ \
-    ); \
-}
+DiagnosticSystem::LogInvalid(TEXT(#InvalidObjectInput), TEXT(__FUNCTION__), TEXT(__FILE__), __LINE__)
 
 // Logs a TODO message to the screen with custom message, function, file, and line info.
 // Usage: LOG_TODO("CustomMessage");
@@ -147,6 +222,11 @@ if (GEngine) \
     __LINE__)); \
 }
 
+// Appends a timestamped message with file, function and line info to the developer log file.
+// The line is handed to a background writer thread; the calling thread never touches the disk.
+// The file defaults to <ProjectLogDir>/DeveloperLogs.txt and can be moved with -DeveloperLogPath=<path>
+// or FDiagnosticFileWriter::GetDeveloperLog().SetFilePath().
+// Usage: LOG_TO_FILE("Your message here.");
 #define LOG_TO_FILE(Message) \
 { \
     FDateTime CurrentTime = FDateTime::Now(); \
@@ -158,17 +238,9 @@ if (GEngine) \
         *FileName, \
         ANSI_TO_TCHAR(__FUNCTION__), \
         __LINE__); \
-    FString FilePath = TEXT("X:\\Age Of Reverse\\Genesis\\Source\\DeveloperLogs.txt"); \
-    FString ExistingContent; \
-    FFileHelper::LoadFileToString(ExistingContent, *FilePath); \
-    ExistingContent += LogMessage; \
-    if (FFileHelper::SaveStringToFile(ExistingContent, *FilePath)) \
+    if (!FDiagnosticFileWriter::GetDeveloperLog().WriteLine(LogMessage)) \
     { \
-        UE_LOG(LogTemp, Log, TEXT("Logged to file: %s"), *LogMessage); \
-    } \
-    else \
-    { \
-        UE_LOG(LogTemp, Error, TEXT("Failed to write to log file: %s"), *FilePath); \
+        UE_LOG(LogTemp, Error, TEXT("Developer log buffer is full, dropped: %s"), *LogMessage); \
     } \
 }
 
@@ -190,15 +262,38 @@ if ((Object) == nullptr)        \
     LOG_IF_DEBUG(Object);       \
 }
 
+#if DIAG_BINARY_LOGGING
+#define SAFE_GETTER_ON_NULL(ContextName, PointerName) \
+do \
+{ \
+    DIAG_RECORD(DIAG_VERBOSITY_ERROR, TEXT("{0}: {1} is null! Ensure it is set before accessing."), ContextName, PointerName); \
+    UE_LOG(LogTemp, Error, TEXT("%s: %s is null! [File: %s, Line: %d, Function: %s] Ensure it is set before accessing."), \
+        *ContextName, *PointerName, TEXT(__FILE__), __LINE__, TEXT(__FUNCTION__)); \
+} while (0)
+#else
+#define SAFE_GETTER_ON_NULL(ContextName, PointerName) \
+    UE_LOG(LogTemp, Error, TEXT("%s: %s is null! [File: %s, Line: %d, Function: %s] Ensure it is set before accessing."), \
+        *ContextName, *PointerName, TEXT(__FILE__), __LINE__, TEXT(__FUNCTION__))
+#endif
+
+#if DIAG_COMPILED_VERBOSITY < DIAG_VERBOSITY_VERBOSE
+#define SAFE_GETTER_ON_SUCCESS(ContextName, PointerName) DIAG_COMPILED_OUT()
+#elif DIAG_BINARY_LOGGING
+#define SAFE_GETTER_ON_SUCCESS(ContextName, PointerName) \
+    DIAG_RECORD(DIAG_VERBOSITY_VERBOSE, TEXT("{0}: {1} retrieved successfully."), ContextName, PointerName)
+#else
+#define SAFE_GETTER_ON_SUCCESS(ContextName, PointerName) \
+    UE_LOG(LogTemp, Verbose, TEXT("%s: %s retrieved successfully. [File: %s, Line: %d, Function: %s]"), \
+        *ContextName, *PointerName, TEXT(__FILE__), __LINE__, TEXT(__FUNCTION__))
+#endif
+
 #define SAFE_GETTER(Pointer, ReturnType, ContextName, PointerName) \
     if (!(Pointer)) \
     { \
-        UE_LOG(LogTemp, Error, TEXT("%s: %s is null! [File: %s, Line: %d, Function: %s] Ensure it is set before accessing."), \
-            *ContextName, *PointerName, TEXT(__FILE__), __LINE__, TEXT(__FUNCTION__)); \
+        SAFE_GETTER_ON_NULL(ContextName, PointerName); \
         return nullptr; \
     } \
-    UE_LOG(LogTemp, Verbose, TEXT("%s: %s retrieved successfully. [File: %s, Line: %d, Function: %s]"), \
-        *ContextName, *PointerName, TEXT(__FILE__), __LINE__, TEXT(__FUNCTION__)); \
+    SAFE_GETTER_ON_SUCCESS(ContextName, PointerName); \
     return (Pointer);
 
 
@@ -245,6 +340,1002 @@ inline bool AreMapsEqual(const TMap<KeyType, ValueType>& MapA, const TMap<KeyTyp
     return true;
 }
 
+/**
+ * Append-only file writer running on its own thread.
+ * Producers copy bytes into a ring buffer under a short lock; the writer thread drains the ring,
+ * appends to an open file handle, flushes periodically and rotates the file once it grows past
+ * MaxFileSize. When the ring is full new data is dropped and counted rather than blocking the caller.
+ *
+ * Writers are meant to live in function-local statics. Teardown normally happens in the OnPreExit handler,
+ * while the engine is still up; writes arriving after that go straight to the file on the caller.
+ * The destructor repeats the same idempotent Shutdown in case OnPreExit never fires.
+ */
+class FDiagnosticFileWriter : public FRunnable
+{
+public:
+    FDiagnosticFileWriter(const TCHAR* InThreadName, const FString& InFilePath, int32 InRingCapacity = 256 * 1024, bool bInAppend = true)
+        : FilePath(InFilePath)
+        , bAppend(bInAppend)
+        , RingCapacity(FMath::RoundUpToPowerOfTwo(FMath::Max(InRingCapacity, 4096)))
+    {
+        Ring.SetNumUninitialized(RingCapacity);
+        WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+
+        if (FPlatformProcess::SupportsMultithreading())
+        {
+            Thread = FRunnableThread::Create(this, InThreadName, 0, TPri_BelowNormal);
+            bRunning = Thread != nullptr;
+        }
+
+        // The first writer can be created from any thread; engine delegates are only bound on the game thread.
+        if (IsInGameThread())
+        {
+            FCoreDelegates::OnPreExit.AddRaw(this, &FDiagnosticFileWriter::Shutdown);
+        }
+        else
+        {
+            AsyncTask(ENamedThreads::GameThread, [this]()
+            {
+                FCoreDelegates::OnPreExit.AddRaw(this, &FDiagnosticFileWriter::Shutdown);
+            });
+        }
+    }
+
+    // Normally a no-op: OnPreExit has already shut down. Covers processes that exit without firing it.
+    virtual ~FDiagnosticFileWriter() override
+    {
+        Shutdown();
+    }
+
+    /** Writer behind LOG_TO_FILE. */
+    static FDiagnosticFileWriter& GetDeveloperLog()
+    {
+        static FDiagnosticFileWriter Writer(TEXT("DeveloperLogWriter"), GetDefaultDeveloperLogPath());
+        return Writer;
+    }
+
+    static FString GetDefaultDeveloperLogPath()
+    {
+        FString Path;
+        if (FParse::Value(FCommandLine::Get(), TEXT("DeveloperLogPath="), Path))
+        {
+            return Path;
+        }
+        return FPaths::Combine(FPaths::ProjectLogDir(), TEXT("DeveloperLogs.txt"));
+    }
+
+    /** Redirects output to a new file. Takes effect on the writer thread's next pass. */
+    void SetFilePath(const FString& InFilePath)
+    {
+        {
+            FScopeLock Lock(&ConfigLock);
+            FilePath = InFilePath;
+            bReopenRequested = true;
+        }
+
+        FScopeLock Lock(&RingLock);
+        if (bRunning)
+        {
+            WakeEvent->Trigger();
+        }
+    }
+
+    /** Size after which the current file is rotated to <Name>.1<Ext>. */
+    void SetMaxFileSize(int64 InMaxFileSize) { MaxFileSize.store(FMath::Max<int64>(InMaxFileSize, 4096)); }
+
+    /** Number of rotated files kept next to the current one. */
+    void SetMaxBackupFiles(int32 InMaxBackupFiles) { MaxBackupFiles.store(FMath::Max(InMaxBackupFiles, 0)); }
+
+    /** Seconds between forced flushes of the file handle. */
+    void SetFlushInterval(float InSeconds) { FlushIntervalSeconds.store(FMath::Max(InSeconds, 0.01f)); }
+
+    /** Runs on the writer thread once per flush interval, before the ring is drained. May call Write. */
+    void SetPeriodicTask(TFunction<void()> InTask)
+    {
+        FScopeLock Lock(&ConfigLock);
+        PeriodicTask = MoveTemp(InTask);
+    }
+
+    /** Copies raw bytes into the ring. Returns false if they did not fit and were dropped. */
+    bool Write(const void* Data, int32 NumBytes)
+    {
+        if (NumBytes <= 0)
+        {
+            return true;
+        }
+
+        {
+            // bRunning only flips under RingLock, so anything queued here is drained before Shutdown returns.
+            FScopeLock Lock(&RingLock);
+            if (bRunning)
+            {
+                if (NumBytes > RingCapacity - static_cast<int32>(Head - Tail))
+                {
+                    ++DroppedWrites;
+                    return false;
+                }
+
+                const uint8* Bytes = static_cast<const uint8*>(Data);
+                const int32 Start = static_cast<int32>(Head & (RingCapacity - 1));
+                const int32 FirstPart = FMath::Min(NumBytes, RingCapacity - Start);
+                FMemory::Memcpy(Ring.GetData() + Start, Bytes, FirstPart);
+                FMemory::Memcpy(Ring.GetData(), Bytes + FirstPart, NumBytes - FirstPart);
+                Head += NumBytes;
+
+                WakeEvent->Trigger();
+                return true;
+            }
+        }
+
+        // No writer thread on this platform, or it has shut down: write through on the caller.
+        FScopeLock Lock(&FileLock);
+        WriteToFile(static_cast<const uint8*>(Data), NumBytes);
+        if (FileHandle && bShutDown)
+        {
+            FileHandle->Flush();
+        }
+        return true;
+    }
+
+    /** Encodes a line as UTF-8 and queues it. */
+    bool WriteLine(const FString& Line)
+    {
+        const FTCHARToUTF8 Utf8(*Line);
+        return Write(Utf8.Get(), Utf8.Length());
+    }
+
+    /** Number of writes dropped because the ring was full. */
+    uint64 GetDroppedWriteCount() const
+    {
+        return DroppedWrites.load();
+    }
+
+    /** Stops the writer thread after draining everything already queued. Bound to OnPreExit; safe to call more than once. */
+    void Shutdown()
+    {
+        if (bShutDown.exchange(true))
+        {
+            return;
+        }
+
+        {
+            FScopeLock Lock(&RingLock);
+            bRunning = false;
+        }
+
+        if (Thread != nullptr)
+        {
+            bStopping = true;
+            WakeEvent->Trigger();
+            Thread->WaitForCompletion();
+            delete Thread;
+            Thread = nullptr;
+        }
+
+        // Picks up anything queued after the thread's last pass.
+        TArray<uint8> Chunk;
+        DrainRing(Chunk);
+
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        WakeEvent = nullptr;
+
+        FScopeLock Lock(&FileLock);
+        CloseFile();
+    }
+
+    //~ Begin FRunnable Interface
+    virtual uint32 Run() override
+    {
+        TArray<uint8> Chunk;
+        double LastFlushTime = FPlatformTime::Seconds();
+
+        while (!bStopping)
+        {
+            WakeEvent->Wait(FMath::Max(1, FMath::RoundToInt(FlushIntervalSeconds.load() * 1000.f)));
+
+            const double Now = FPlatformTime::Seconds();
+            const bool bFlushDue = Now - LastFlushTime >= FlushIntervalSeconds.load();
+            if (bFlushDue)
+            {
+                TFunction<void()> Task;
+                {
+                    FScopeLock Lock(&ConfigLock);
+                    Task = PeriodicTask;
+                }
+                if (Task)
+                {
+                    Task();
+                }
+            }
+
+            DrainRing(Chunk);
+
+            if (bFlushDue)
+            {
+                FScopeLock Lock(&FileLock);
+                if (FileHandle)
+                {
+                    FileHandle->Flush();
+                }
+                LastFlushTime = Now;
+            }
+        }
+
+        DrainRing(Chunk);
+        return 0;
+    }
+
+    virtual void Stop() override
+    {
+        bStopping = true;
+        WakeEvent->Trigger();
+    }
+    //~ End FRunnable Interface
+
+private:
+    void DrainRing(TArray<uint8>& Chunk)
+    {
+        {
+            FScopeLock Lock(&RingLock);
+            const int32 NumBytes = static_cast<int32>(Head - Tail);
+            Chunk.Reset();
+            Chunk.AddUninitialized(NumBytes);
+
+            const int32 Start = static_cast<int32>(Tail & (RingCapacity - 1));
+            const int32 FirstPart = FMath::Min(NumBytes, RingCapacity - Start);
+            FMemory::Memcpy(Chunk.GetData(), Ring.GetData() + Start, FirstPart);
+            FMemory::Memcpy(Chunk.GetData() + FirstPart, Ring.GetData(), NumBytes - FirstPart);
+            Tail = Head;
+        }
+
+        if (Chunk.Num() > 0)
+        {
+            FScopeLock Lock(&FileLock);
+            WriteToFile(Chunk.GetData(), Chunk.Num());
+        }
+    }
+
+    /** Requires FileLock. */
+    void WriteToFile(const uint8* Data, int32 NumBytes)
+    {
+        bool bReopen = false;
+        {
+            FScopeLock Lock(&ConfigLock);
+            bReopen = bReopenRequested;
+            bReopenRequested = false;
+        }
+
+        if (bReopen)
+        {
+            CloseFile();
+        }
+
+        if (FileHandle == nullptr && !OpenFile())
+        {
+            return;
+        }
+
+        FileHandle->Write(Data, NumBytes);
+        CurrentFileSize += NumBytes;
+
+        if (CurrentFileSize >= MaxFileSize.load())
+        {
+            RotateFile();
+        }
+    }
+
+    /** Requires FileLock. */
+    bool OpenFile()
+    {
+        FString Path;
+        {
+            FScopeLock Lock(&ConfigLock);
+            Path = FilePath;
+        }
+
+        IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+        PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Path));
+
+        // Append mode: existing content is never read back. Non-append writers start fresh once per session.
+        FileHandle = PlatformFile.OpenWrite(*Path, bAppend || bHasOpened, true);
+        bHasOpened = true;
+        CurrentFileSize = FileHandle ? FileHandle->Size() : 0;
+        OpenPath = Path;
+        return FileHandle != nullptr;
+    }
+
+    /** Requires FileLock. */
+    void CloseFile()
+    {
+        if (FileHandle)
+        {
+            FileHandle->Flush();
+            delete FileHandle;
+            FileHandle = nullptr;
+        }
+    }
+
+    /** Requires FileLock. Shifts <Name>.N<Ext> up by one and starts a fresh file. */
+    void RotateFile()
+    {
+        CloseFile();
+
+        IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+        const FString Base = FPaths::GetBaseFilename(OpenPath, false);
+        const FString Extension = FPaths::GetExtension(OpenPath, true);
+        const int32 Backups = MaxBackupFiles.load();
+
+        if (Backups <= 0)
+        {
+            PlatformFile.DeleteFile(*OpenPath);
+        }
+        else
+        {
+            PlatformFile.DeleteFile(*FString::Printf(TEXT("%s.%d%s"), *Base, Backups, *Extension));
+            for (int32 Index = Backups - 1; Index >= 1; --Index)
+            {
+                PlatformFile.MoveFile(*FString::Printf(TEXT("%s.%d%s"), *Base, Index + 1, *Extension), *FString::Printf(TEXT("%s.%d%s"), *Base, Index, *Extension));
+            }
+            PlatformFile.MoveFile(*FString::Printf(TEXT("%s.1%s"), *Base, *Extension), *OpenPath);
+        }
+
+        OpenFile();
+    }
+
+    FString FilePath;
+    FString OpenPath;
+    FCriticalSection ConfigLock;
+    bool bReopenRequested = false;
+    TFunction<void()> PeriodicTask;
+    const bool bAppend;
+    bool bHasOpened = false;
+
+    TArray<uint8> Ring;
+    const int32 RingCapacity;
+    uint64 Head = 0;
+    uint64 Tail = 0;
+    std::atomic<uint64> DroppedWrites{ 0 };
+    FCriticalSection RingLock;
+
+    IFileHandle* FileHandle = nullptr;
+    int64 CurrentFileSize = 0;
+    FCriticalSection FileLock;
+
+    std::atomic<int64> MaxFileSize{ 16 * 1024 * 1024 };
+    std::atomic<int32> MaxBackupFiles{ 3 };
+    std::atomic<float> FlushIntervalSeconds{ 1.f };
+    std::atomic<bool> bStopping{ false };
+
+    /** True while the writer thread owns the ring. Written under RingLock. */
+    std::atomic<bool> bRunning{ false };
+    std::atomic<bool> bShutDown{ false };
+
+    FEvent* WakeEvent = nullptr;
+    FRunnableThread* Thread = nullptr;
+};
+
+/**
+ * Deferred-format binary log behind LOG_ERROR, LOG_INFO, LOG_VERBOSE and SAFE_GETTER.
+ *
+ * Each call site registers once and receives a small ID. A call then appends only
+ * [SiteId][Cycles][NumArgs][Args...] to a per-thread buffer; nothing is formatted.
+ * Full buffers are handed to an FDiagnosticFileWriter as self-contained chunks. The game thread
+ * flushes its own buffer every frame; the writer thread flushes every registered buffer once per
+ * flush interval, so entries from quiet worker threads still reach the file.
+ *
+ * Session files, both in the project log directory:
+ *  - DiagnosticLog.sites : header plus one record per call site (file, line, function, format)
+ *  - DiagnosticLog.bin   : chunks of [ThreadId][Size][Entries...]
+ *
+ * Decode() turns the pair back into readable text after the session; see diag.DecodeBinaryLog.
+ */
+class FDiagnosticBinaryLog
+{
+public:
+    enum class EArgType : uint8
+    {
+        Int32,
+        UInt32,
+        Int64,
+        Float,
+        Double,
+        Bool,
+        String
+    };
+
+    static constexpr uint32 SitesMagic = 0x53474144; // 'DAGS'
+    static constexpr uint32 ChunkHeaderSize = sizeof(uint32) * 2;
+    static constexpr int32 ThreadBufferFlushSize = 60 * 1024;
+
+    /** Registers a call site and returns its ID. Called once per site through a function-local static. */
+    static uint32 RegisterSite(uint8 Verbosity, const TCHAR* File, int32 Line, const TCHAR* Function, const TCHAR* Format)
+    {
+        FState& State = Get();
+        FScopeLock Lock(&State.SiteLock);
+
+        const uint32 SiteId = State.NumSites++;
+
+        TArray<uint8> SiteRecord;
+        Append(SiteRecord, SiteId);
+        Append(SiteRecord, Verbosity);
+        Append(SiteRecord, Line);
+        AppendUtf8(SiteRecord, FPaths::GetCleanFilename(File));
+        AppendUtf8(SiteRecord, Function);
+        AppendUtf8(SiteRecord, Format);
+        State.SitesWriter.Write(SiteRecord.GetData(), SiteRecord.Num());
+
+        return SiteId;
+    }
+
+    /** Appends one entry to this thread's buffer. Arguments are copied raw, never formatted. */
+    template <typename... ArgTypes>
+    static void Record(uint32 SiteId, const ArgTypes&... Args)
+    {
+        FThreadBuffer& Buffer = GetThreadBuffer();
+
+        // Only contended while the writer thread's periodic flush is visiting this buffer.
+        FScopeLock Lock(&Buffer.Lock);
+        TArray<uint8>& Bytes = Buffer.Bytes;
+
+        Append(Bytes, SiteId);
+        Append(Bytes, FPlatformTime::Cycles64());
+        Append(Bytes, static_cast<uint8>(sizeof...(ArgTypes)));
+        (AppendArg(Bytes, Args), ...);
+
+        if (Bytes.Num() >= ThreadBufferFlushSize)
+        {
+            Buffer.Flush(Get().LogWriter);
+        }
+    }
+
+    /** Hands this thread's pending entries to the writer. Runs on the game thread at the end of every frame. */
+    static void FlushThisThread()
+    {
+        FThreadBuffer& Buffer = GetThreadBuffer();
+        FScopeLock Lock(&Buffer.Lock);
+        Buffer.Flush(Get().LogWriter);
+    }
+
+    /** Hands every thread's pending entries to the writer. */
+    static void FlushAllThreads()
+    {
+        Get().FlushAllThreads();
+    }
+
+    static FString GetDefaultSitesPath()
+    {
+        return FPaths::Combine(FPaths::ProjectLogDir(), TEXT("DiagnosticLog.sites"));
+    }
+
+    static FString GetDefaultLogPath()
+    {
+        return FPaths::Combine(FPaths::ProjectLogDir(), TEXT("DiagnosticLog.bin"));
+    }
+
+    /**
+     * Offline decoder: rebuilds readable lines from a .sites/.bin pair.
+     * @return false if either file is missing or was written by an incompatible build.
+     */
+    static bool Decode(const FString& SitesPath, const FString& LogPath, TArray<FString>& OutLines)
+    {
+        struct FSite
+        {
+            uint8 Verbosity = 0;
+            int32 Line = 0;
+            FString File;
+            FString Function;
+            FString Format;
+        };
+
+        TArray<uint8> SitesData;
+        TArray<uint8> LogData;
+        if (!FFileHelper::LoadFileToArray(SitesData, *SitesPath) || !FFileHelper::LoadFileToArray(LogData, *LogPath))
+        {
+            return false;
+        }
+
+        int32 Offset = 0;
+        uint32 Magic = 0;
+        uint8 CharSize = 0;
+        double SecondsPerCycle = 0.0;
+        uint64 BaseCycles = 0;
+        if (!Read(SitesData, Offset, Magic) || Magic != SitesMagic
+            || !Read(SitesData, Offset, CharSize) || CharSize != sizeof(TCHAR)
+            || !Read(SitesData, Offset, SecondsPerCycle)
+            || !Read(SitesData, Offset, BaseCycles))
+        {
+            return false;
+        }
+
+        TMap<uint32, FSite> Sites;
+        while (Offset < SitesData.Num())
+        {
+            uint32 SiteId = 0;
+            FSite Site;
+            if (!Read(SitesData, Offset, SiteId) || !Read(SitesData, Offset, Site.Verbosity) || !Read(SitesData, Offset, Site.Line)
+                || !ReadUtf8(SitesData, Offset, Site.File) || !ReadUtf8(SitesData, Offset, Site.Function) || !ReadUtf8(SitesData, Offset, Site.Format))
+            {
+                return false;
+            }
+            Sites.Add(SiteId, MoveTemp(Site));
+        }
+
+        static const TCHAR* VerbosityNames[] = { TEXT("?"), TEXT("Error"), TEXT("Warning"), TEXT("Info"), TEXT("Verbose") };
+
+        Offset = 0;
+        while (Offset < LogData.Num())
+        {
+            uint32 ThreadId = 0;
+            uint32 ChunkSize = 0;
+            if (!Read(LogData, Offset, ThreadId) || !Read(LogData, Offset, ChunkSize) || Offset + static_cast<int32>(ChunkSize) > LogData.Num())
+            {
+                return false;
+            }
+
+            const int32 ChunkEnd = Offset + static_cast<int32>(ChunkSize);
+            while (Offset < ChunkEnd)
+            {
+                uint32 SiteId = 0;
+                uint64 Cycles = 0;
+                uint8 NumArgs = 0;
+                if (!Read(LogData, Offset, SiteId) || !Read(LogData, Offset, Cycles) || !Read(LogData, Offset, NumArgs))
+                {
+                    return false;
+                }
+
+                TArray<FString> Args;
+                for (uint8 ArgIndex = 0; ArgIndex < NumArgs; ++ArgIndex)
+                {
+                    if (!ReadArg(LogData, Offset, Args))
+                    {
+                        return false;
+                    }
+                }
+
+                const FSite* Site = Sites.Find(SiteId);
+                const double Seconds = static_cast<double>(Cycles - BaseCycles) * SecondsPerCycle;
+                if (Site == nullptr)
+                {
+                    OutLines.Add(FString::Printf(TEXT("[%.6f][T%u] <unknown site %u>"), Seconds, ThreadId, SiteId));
+                    continue;
+                }
+
+                OutLines.Add(FString::Printf(TEXT("[%.6f][T%u][%s] %s:%d: %s: %s"),
+                    Seconds,
+                    ThreadId,
+                    VerbosityNames[Site->Verbosity < UE_ARRAY_COUNT(VerbosityNames) ? Site->Verbosity : 0],
+                    *Site->File,
+                    Site->Line,
+                    *Site->Function,
+                    *FormatMessage(Site->Format, Args)));
+            }
+        }
+
+        return true;
+    }
+
+private:
+    struct FThreadBuffer;
+
+    struct FState
+    {
+        FCriticalSection SiteLock;
+        uint32 NumSites = 0;
+        FDiagnosticFileWriter SitesWriter;
+        FDiagnosticFileWriter LogWriter;
+
+        /** Every live thread buffer. Lock order: BuffersLock, then a buffer's Lock, then the writer's. */
+        FCriticalSection BuffersLock;
+        TArray<FThreadBuffer*> Buffers;
+
+        FState()
+            : SitesWriter(TEXT("DiagnosticSitesWriter"), GetDefaultSitesPath(), 64 * 1024, false)
+            , LogWriter(TEXT("DiagnosticLogWriter"), GetDefaultLogPath(), 1024 * 1024, false)
+        {
+            // The sites file is the session's dictionary; it must never rotate away. Decode reads only the
+            // current log file, so the log does not rotate either.
+            SitesWriter.SetMaxFileSize(MAX_int64);
+            LogWriter.SetMaxFileSize(MAX_int64);
+
+            TArray<uint8> Header;
+            Append(Header, SitesMagic);
+            Append(Header, static_cast<uint8>(sizeof(TCHAR)));
+            Append(Header, FPlatformTime::GetSecondsPerCycle64());
+            Append(Header, FPlatformTime::Cycles64());
+            SitesWriter.Write(Header.GetData(), Header.Num());
+
+            LogWriter.SetPeriodicTask([this]() { FlushAllThreads(); });
+
+            // The first log call can come from any thread; engine delegates are only bound on the game thread.
+            // OnPreExit runs after the writers' own handlers, so the final flush writes straight to the file.
+            auto BindFlushDelegates = []()
+            {
+                FCoreDelegates::OnEndFrame.AddStatic(&FDiagnosticBinaryLog::FlushThisThread);
+                FCoreDelegates::OnPreExit.AddStatic(&FDiagnosticBinaryLog::FlushAllThreads);
+            };
+
+            if (IsInGameThread())
+            {
+                BindFlushDelegates();
+            }
+            else
+            {
+                AsyncTask(ENamedThreads::GameThread, BindFlushDelegates);
+            }
+        }
+
+        void FlushAllThreads()
+        {
+            FScopeLock Lock(&BuffersLock);
+            for (FThreadBuffer* Buffer : Buffers)
+            {
+                FScopeLock BufferLock(&Buffer->Lock);
+                Buffer->Flush(LogWriter);
+            }
+        }
+    };
+
+    struct FThreadBuffer
+    {
+        FCriticalSection Lock;
+        TArray<uint8> Bytes;
+        const uint32 ThreadId;
+
+        FThreadBuffer()
+            : ThreadId(FPlatformTLS::GetCurrentThreadId())
+        {
+            Bytes.Reserve(ThreadBufferFlushSize + 1024);
+            Bytes.AddZeroed(ChunkHeaderSize);
+
+            FState& State = Get();
+            FScopeLock RegistryLock(&State.BuffersLock);
+            State.Buffers.Add(this);
+        }
+
+        ~FThreadBuffer()
+        {
+            FState& State = Get();
+            FScopeLock RegistryLock(&State.BuffersLock);
+            State.Buffers.RemoveSingleSwap(this);
+
+            FScopeLock BufferLock(&Lock);
+            Flush(State.LogWriter);
+        }
+
+        /** Requires Lock. May run on any thread; the chunk is tagged with the owning thread. */
+        void Flush(FDiagnosticFileWriter& Writer)
+        {
+            const uint32 PayloadSize = static_cast<uint32>(Bytes.Num()) - ChunkHeaderSize;
+            if (PayloadSize == 0)
+            {
+                return;
+            }
+
+            // Header is patched in place so the chunk goes out as a single ring write.
+            FMemory::Memcpy(Bytes.GetData(), &ThreadId, sizeof(uint32));
+            FMemory::Memcpy(Bytes.GetData() + sizeof(uint32), &PayloadSize, sizeof(uint32));
+            Writer.Write(Bytes.GetData(), Bytes.Num());
+
+            Bytes.SetNum(ChunkHeaderSize);
+        }
+    };
+
+    static FState& Get()
+    {
+        static FState State;
+        return State;
+    }
+
+    static FThreadBuffer& GetThreadBuffer()
+    {
+        thread_local FThreadBuffer Buffer;
+        return Buffer;
+    }
+
+    template <typename ValueType>
+    static void Append(TArray<uint8>& Bytes, const ValueType& Value)
+    {
+        Bytes.Append(reinterpret_cast<const uint8*>(&Value), sizeof(ValueType));
+    }
+
+    static void AppendUtf8(TArray<uint8>& Bytes, const TCHAR* Text)
+    {
+        const FTCHARToUTF8 Utf8(Text);
+        Append(Bytes, static_cast<int32>(Utf8.Length()));
+        Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    }
+
+    static void AppendUtf8(TArray<uint8>& Bytes, const FString& Text)
+    {
+        AppendUtf8(Bytes, *Text);
+    }
+
+    static void AppendString(TArray<uint8>& Bytes, const TCHAR* Text, int32 Len)
+    {
+        Append(Bytes, EArgType::String);
+        Append(Bytes, Len);
+        Bytes.Append(reinterpret_cast<const uint8*>(Text), Len * sizeof(TCHAR));
+    }
+
+    static void AppendArg(TArray<uint8>& Bytes, int32 Value)       { Append(Bytes, EArgType::Int32); Append(Bytes, Value); }
+    static void AppendArg(TArray<uint8>& Bytes, uint32 Value)      { Append(Bytes, EArgType::UInt32); Append(Bytes, Value); }
+    static void AppendArg(TArray<uint8>& Bytes, int64 Value)       { Append(Bytes, EArgType::Int64); Append(Bytes, Value); }
+    static void AppendArg(TArray<uint8>& Bytes, float Value)       { Append(Bytes, EArgType::Float); Append(Bytes, Value); }
+    static void AppendArg(TArray<uint8>& Bytes, double Value)      { Append(Bytes, EArgType::Double); Append(Bytes, Value); }
+    static void AppendArg(TArray<uint8>& Bytes, bool Value)        { Append(Bytes, EArgType::Bool); Append(Bytes, static_cast<uint8>(Value)); }
+    static void AppendArg(TArray<uint8>& Bytes, const TCHAR* Value) { AppendString(Bytes, Value ? Value : TEXT(""), Value ? FCString::Strlen(Value) : 0); }
+    static void AppendArg(TArray<uint8>& Bytes, const FString& Value) { AppendString(Bytes, *Value, Value.Len()); }
+
+    template <typename ValueType>
+    static bool Read(const TArray<uint8>& Bytes, int32& Offset, ValueType& OutValue)
+    {
+        if (Offset + static_cast<int32>(sizeof(ValueType)) > Bytes.Num())
+        {
+            return false;
+        }
+        FMemory::Memcpy(&OutValue, Bytes.GetData() + Offset, sizeof(ValueType));
+        Offset += sizeof(ValueType);
+        return true;
+    }
+
+    static bool ReadUtf8(const TArray<uint8>& Bytes, int32& Offset, FString& OutText)
+    {
+        int32 Len = 0;
+        if (!Read(Bytes, Offset, Len) || Len < 0 || Offset + Len > Bytes.Num())
+        {
+            return false;
+        }
+        const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData() + Offset), Len);
+        OutText = FString(Converted.Length(), Converted.Get());
+        Offset += Len;
+        return true;
+    }
+
+    /**
+     * Fills {N} placeholders with the recorded arguments. Unlike FString::Format, braces that are not
+     * a valid placeholder are copied through, so messages may contain literal '{' and '}'.
+     */
+    static FString FormatMessage(const FString& Format, const TArray<FString>& Args)
+    {
+        FString Result;
+        Result.Reserve(Format.Len());
+
+        const TCHAR* Chars = *Format;
+        const int32 Len = Format.Len();
+        for (int32 Index = 0; Index < Len; ++Index)
+        {
+            if (Chars[Index] == TEXT('{'))
+            {
+                int32 End = Index + 1;
+                int32 ArgIndex = 0;
+                while (End < Len && FChar::IsDigit(Chars[End]) && End - Index <= 3)
+                {
+                    ArgIndex = ArgIndex * 10 + (Chars[End] - TEXT('0'));
+                    ++End;
+                }
+
+                if (End > Index + 1 && End < Len && Chars[End] == TEXT('}') && Args.IsValidIndex(ArgIndex))
+                {
+                    Result += Args[ArgIndex];
+                    Index = End;
+                    continue;
+                }
+            }
+            Result.AppendChar(Chars[Index]);
+        }
+        return Result;
+    }
+
+    static bool ReadArg(const TArray<uint8>& Bytes, int32& Offset, TArray<FString>& OutArgs)
+    {
+        EArgType Type;
+        if (!Read(Bytes, Offset, Type))
+        {
+            return false;
+        }
+
+        switch (Type)
+        {
+        case EArgType::Int32:  { int32 Value;  if (!Read(Bytes, Offset, Value)) { return false; } OutArgs.Add(LexToString(Value)); return true; }
+        case EArgType::UInt32: { uint32 Value; if (!Read(Bytes, Offset, Value)) { return false; } OutArgs.Add(LexToString(Value)); return true; }
+        case EArgType::Int64:  { int64 Value;  if (!Read(Bytes, Offset, Value)) { return false; } OutArgs.Add(LexToString(Value)); return true; }
+        case EArgType::Float:  { float Value;  if (!Read(Bytes, Offset, Value)) { return false; } OutArgs.Add(FString::SanitizeFloat(Value)); return true; }
+        case EArgType::Double: { double Value; if (!Read(Bytes, Offset, Value)) { return false; } OutArgs.Add(FString::SanitizeFloat(Value)); return true; }
+        case EArgType::Bool:   { uint8 Value;  if (!Read(Bytes, Offset, Value)) { return false; } OutArgs.Add(Value ? TEXT("true") : TEXT("false")); return true; }
+        case EArgType::String:
+        {
+            int32 Len = 0;
+            if (!Read(Bytes, Offset, Len) || Len < 0 || Offset + Len * static_cast<int32>(sizeof(TCHAR)) > Bytes.Num())
+            {
+                return false;
+            }
+            OutArgs.Add(FString(Len, reinterpret_cast<const TCHAR*>(Bytes.GetData() + Offset)));
+            Offset += Len * sizeof(TCHAR);
+            return true;
+        }
+        }
+        return false;
+    }
+};
+
+/**
+ * diag.DecodeBinaryLog [SitesPath LogPath] [OutPath] : decodes a binary log session to text.
+ * Defaults to this session's files in the project log directory and prints to the console unless OutPath is given.
+ */
+inline FAutoConsoleCommandWithWorldArgsAndOutputDevice DiagDecodeBinaryLogCommand(
+    TEXT("diag.DecodeBinaryLog"),
+    TEXT("Decodes DiagnosticLog.sites/.bin to text. Usage: diag.DecodeBinaryLog [SitesPath LogPath] [OutPath]"),
+    FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+    {
+        const bool bExplicitInputs = Args.Num() >= 2;
+        const FString SitesPath = bExplicitInputs ? Args[0] : FDiagnosticBinaryLog::GetDefaultSitesPath();
+        const FString LogPath = bExplicitInputs ? Args[1] : FDiagnosticBinaryLog::GetDefaultLogPath();
+        const FString OutPath = Args.Num() == 1 ? Args[0] : Args.Num() >= 3 ? Args[2] : FString();
+
+        // Entries still buffered by the writers are not on disk yet and are left out.
+        FDiagnosticBinaryLog::FlushThisThread();
+
+        TArray<FString> Lines;
+        if (!FDiagnosticBinaryLog::Decode(SitesPath, LogPath, Lines))
+        {
+            Ar.Logf(TEXT("Failed to decode %s / %s: missing files or written by an incompatible build."), *SitesPath, *LogPath);
+            return;
+        }
+
+        if (OutPath.IsEmpty())
+        {
+            for (const FString& Line : Lines)
+            {
+                Ar.Log(Line);
+            }
+            return;
+        }
+
+        if (FFileHelper::SaveStringArrayToFile(Lines, *OutPath))
+        {
+            Ar.Logf(TEXT("Decoded %d entries to %s"), Lines.Num(), *OutPath);
+        }
+        else
+        {
+            Ar.Logf(TEXT("Failed to write %s"), *OutPath);
+        }
+    }));
+
+/** Minimum seconds between two LOG_INVALID messages from the same call site. */
+inline TAutoConsoleVariable<float> CVarDiagInvalidLogInterval(
+    TEXT("diag.InvalidLogInterval"),
+    5.f,
+    TEXT("Minimum seconds between two LOG_INVALID messages from the same call site. Hits in between are collapsed into one xN line. 0 disables rate limiting."));
+
+/**
+ * Per-call-site occurrence table behind LOG_INVALID.
+ * Decides whether a hit is emitted or folded into the next emitted line.
+ */
+class FDiagnosticInvalidTracker
+{
+public:
+    struct FSiteStats
+    {
+        const TCHAR* ObjectName = nullptr;
+        const TCHAR* FunctionName = nullptr;
+        const TCHAR* FileName = nullptr;
+        int32 LineNumber = 0;
+        uint64 TotalCount = 0;
+        uint64 EmittedCount = 0;
+        int32 SuppressedSinceEmit = 0;
+        double LastEmitTime = -DBL_MAX;
+    };
+
+    static uint32 MakeSiteKey(const TCHAR* FileName, int32 LineNumber)
+    {
+        return HashCombine(FCrc::StrCrc32(FileName), GetTypeHash(LineNumber));
+    }
+
+    /**
+     * Counts a hit and reports whether it should be logged now.
+     * @param OutCount - Hits represented by this message (1 + hits collapsed since the last one).
+     */
+    static bool ShouldEmit(uint32 SiteKey, const TCHAR* ObjectName, const TCHAR* FunctionName, const TCHAR* FileName, int32 LineNumber, int32& OutCount)
+    {
+        FState& State = Get();
+        const double Now = FPlatformTime::Seconds();
+        const double Interval = CVarDiagInvalidLogInterval.GetValueOnAnyThread();
+
+        FScopeLock Lock(&State.Lock);
+
+        FSiteStats& Stats = State.Sites.FindOrAdd(SiteKey);
+        if (Stats.ObjectName == nullptr)
+        {
+            Stats.ObjectName = ObjectName;
+            Stats.FunctionName = FunctionName;
+            Stats.FileName = FileName;
+            Stats.LineNumber = LineNumber;
+        }
+
+        ++Stats.TotalCount;
+
+        if (Interval > 0.0 && Now - Stats.LastEmitTime < Interval)
+        {
+            ++Stats.SuppressedSinceEmit;
+            return false;
+        }
+
+        OutCount = Stats.SuppressedSinceEmit + 1;
+        Stats.SuppressedSinceEmit = 0;
+        Stats.LastEmitTime = Now;
+        ++Stats.EmittedCount;
+        return true;
+    }
+
+    /**
+     * Collects every call site with hits folded in since its last message, as if each were emitted now.
+     * SuppressedSinceEmit in the returned copies holds the number of hits the message stands for.
+     */
+    static void TakePending(TArray<FSiteStats>& OutPending)
+    {
+        FState& State = Get();
+        const double Now = FPlatformTime::Seconds();
+
+        FScopeLock Lock(&State.Lock);
+        for (TPair<uint32, FSiteStats>& Pair : State.Sites)
+        {
+            FSiteStats& Stats = Pair.Value;
+            if (Stats.SuppressedSinceEmit > 0)
+            {
+                OutPending.Add(Stats);
+                Stats.SuppressedSinceEmit = 0;
+                Stats.LastEmitTime = Now;
+                ++Stats.EmittedCount;
+            }
+        }
+    }
+
+    /** Prints every call site, most frequent first. */
+    static void DumpStats(FOutputDevice& Ar)
+    {
+        FState& State = Get();
+        TArray<FSiteStats> Sorted;
+        {
+            FScopeLock Lock(&State.Lock);
+            State.Sites.GenerateValueArray(Sorted);
+        }
+
+        Sorted.Sort([](const FSiteStats& A, const FSiteStats& B) { return A.TotalCount > B.TotalCount; });
+
+        Ar.Logf(TEXT("LOG_INVALID call sites: %d"), Sorted.Num());
+        for (const FSiteStats& Stats : Sorted)
+        {
+            Ar.Logf(TEXT("  x%llu (%llu emitted) %s in %s [%s:%d]"),
+                Stats.TotalCount,
+                Stats.EmittedCount,
+                Stats.ObjectName,
+                Stats.FunctionName,
+                *FPaths::GetCleanFilename(Stats.FileName),
+                Stats.LineNumber);
+        }
+    }
+
+    static void ResetStats()
+    {
+        FState& State = Get();
+        FScopeLock Lock(&State.Lock);
+        State.Sites.Reset();
+    }
+
+private:
+    struct FState
+    {
+        FCriticalSection Lock;
+        TMap<uint32, FSiteStats> Sites;
+    };
+
+    static FState& Get()
+    {
+        static FState State;
+        return State;
+    }
+};
+
 class AGEOFREVERSE_API DiagnosticSystem
 {
 
@@ -255,4 +1346,79 @@ public:
     // Log invalid object
     static void LogInvalid(const FString& InvalidObjectName, const FString& FunctionName, const FString& FileName, int32 LineNumber);
 
+    // Log invalid object from a LOG_INVALID call site, rate limited per site by FDiagnosticInvalidTracker
+    static void LogInvalid(const TCHAR* InvalidObjectName, const TCHAR* FunctionName, const TCHAR* FileName, int32 LineNumber)
+    {
+        if (!GEngine)
+        {
+            return;
+        }
+
+        BindInvalidFlush();
+
+        int32 Count = 0;
+        const uint32 SiteKey = FDiagnosticInvalidTracker::MakeSiteKey(FileName, LineNumber);
+        if (FDiagnosticInvalidTracker::ShouldEmit(SiteKey, InvalidObjectName, FunctionName, FileName, LineNumber, Count))
+        {
+            LogInvalid(Count > 1 ? FString::Printf(TEXT("%s x%d"), InvalidObjectName, Count) : FString(InvalidObjectName),
+                FunctionName, FileName, LineNumber);
+        }
+    }
+
+    // Log the hits each call site folded in since its last message
+    static void FlushPendingInvalid()
+    {
+        if (!GEngine)
+        {
+            return;
+        }
+
+        TArray<FDiagnosticInvalidTracker::FSiteStats> Pending;
+        FDiagnosticInvalidTracker::TakePending(Pending);
+        for (const FDiagnosticInvalidTracker::FSiteStats& Stats : Pending)
+        {
+            LogInvalid(FString::Printf(TEXT("%s x%d"), Stats.ObjectName, Stats.SuppressedSinceEmit),
+                Stats.FunctionName, Stats.FileName, Stats.LineNumber);
+        }
+    }
+
+private:
+    // The first LOG_INVALID can come from any thread; engine delegates are only bound on the game thread.
+    static void BindInvalidFlush()
+    {
+        static const bool bBound = []()
+        {
+            auto Bind = []()
+            {
+                FCoreDelegates::OnPreExit.AddStatic(&DiagnosticSystem::FlushPendingInvalid);
+            };
+
+            if (IsInGameThread())
+            {
+                Bind();
+            }
+            else
+            {
+                AsyncTask(ENamedThreads::GameThread, Bind);
+            }
+            return true;
+        }();
+        (void)bBound;
+    }
+
 };
+
+/** diag.InvalidStats [reset] : prints pending LOG_INVALID hits, then occurrence counts per call site. */
+inline FAutoConsoleCommandWithWorldArgsAndOutputDevice DiagInvalidStatsCommand(
+    TEXT("diag.InvalidStats"),
+    TEXT("Logs pending LOG_INVALID hits, then prints occurrence counts per call site. Pass 'reset' to clear them."),
+    FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+    {
+        if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+        {
+            FDiagnosticInvalidTracker::ResetStats();
+            return;
+        }
+        DiagnosticSystem::FlushPendingInvalid();
+        FDiagnosticInvalidTracker::DumpStats(Ar);
+    }));